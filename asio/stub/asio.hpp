@@ -46,6 +46,7 @@ struct dummy_base
     {
     }
     void set_option(const dummy_base &) const {};
+    void set_option(const dummy_base &, const dummy_base &) const {};
 };
 inline bool write(const dummy_base &, const dummy_base &, const dummy_base &)
 {
@@ -55,7 +56,15 @@ inline bool read(const dummy_base &, const dummy_base &, const dummy_base &)
 {
     return true;
 }
+inline void async_write(const dummy_base &, const dummy_base &, const dummy_base &)
+{
+}
+inline void async_read(const dummy_base &, const dummy_base &, const dummy_base &)
+{
+}
 using buffer = dummy_base;
+using const_buffer = dummy_base;
+using mutable_buffer = dummy_base;
 struct io_service : dummy_base
 {
     template <class... Args>
@@ -68,6 +77,7 @@ struct io_service : dummy_base
 
     void run(const dummy_base &) const {};
     void stop() const {};
+    void post(const dummy_base &) const {};
 };
 struct socket_base : dummy_base
 {
@@ -76,6 +86,10 @@ struct socket_base : dummy_base
     using linger = dummy_base;
     using enable_connection_aborted = dummy_base;
     void close() const {};
+    void close(const dummy_base &) const {};
+    void non_blocking(bool, const dummy_base &) const {};
+    size_t write_some(const dummy_base &, const dummy_base &) const { return 0; };
+    int native_handle() const { return -1; };
 };
 
 bool write(const dummy_base &, const dummy_base &, const dummy_base &);
@@ -87,6 +101,7 @@ struct error_code : dummy_base, std::error_code
 namespace error
 {
 static const error_code eof{};
+static const error_code would_block{};
 }
 
 namespace ip
@@ -110,8 +125,26 @@ struct acceptor : dummy_base
     void open(const dummy_base &) const {};
     void bind(const dummy_base &) const {};
     void listen() const {};
+    bool is_open() const { return false; };
     void async_accept(const dummy_base &, const dummy_base &) const {};
 };
 }
 }
+
+namespace generic
+{
+struct stream_protocol
+{
+    using socket = socket_base;
+};
+}
+
+namespace local
+{
+struct stream_protocol
+{
+    using endpoint = ip::tcp::endpoint;
+    using acceptor = ip::tcp::acceptor;
+};
+}
 }
@@ -34,6 +34,7 @@
 #include <NonCopyable.hpp>
 
 #include <iostream>
+#include <sstream>
 #include <limits>
 #include <string>
 #include <map>
@@ -101,6 +102,7 @@ private:
 static void defaultLogCb(void *, PfwLogLevel level, const char *logLine)
 {
     switch (level) {
+    case pfwLogDebug:
     case pfwLogInfo:
         std::cout << logLine << std::endl;
         break;
@@ -145,10 +147,15 @@ struct PfwHandler_ : private utility::NonCopyable
 
     pfw::Criteria criteria;
     pfw::Pfw *pfw = nullptr;
+    /** Minimum log level, kept to be set on start if the pfw is not started yet. */
+    CParameterMgrPlatformConnector::LogLevel logLevel =
+        CParameterMgrPlatformConnector::LogLevel::info;
     /** Status of the last called function.
       * Is mutable because even a const function can fail.
       */
     mutable Status lastStatus;
+    /** Result of the last pfwGetMetrics call. */
+    mutable string metrics;
 
 private:
     LogWrapper mLogger;
@@ -234,6 +241,7 @@ bool pfwStart(PfwHandler *handle, const char *configPath, const PfwCriterion cri
     handle->pfw = new CParameterMgrPlatformConnector(configPath);
 
     handle->setLogger(logger);
+    handle->pfw->setLogLevel(handle->logLevel);
 
     if (not handle->createCriteria(criteria, criterionNb)) {
         return status.failure();
@@ -242,6 +250,45 @@ bool pfwStart(PfwHandler *handle, const char *configPath, const PfwCriterion cri
     return status.forward(handle->pfw->start(status.msg()));
 }
 
+bool pfwSetLogLevel(PfwHandler *handle, PfwLogLevel level)
+{
+    Status &status = handle->lastStatus;
+    using Level = CParameterMgrPlatformConnector::LogLevel;
+    Level pfwLevel;
+    switch (level) {
+    case pfwLogDebug:
+        pfwLevel = Level::debug;
+        break;
+    case pfwLogInfo:
+        pfwLevel = Level::info;
+        break;
+    case pfwLogWarning:
+        pfwLevel = Level::warning;
+        break;
+    default:
+        return status.failure("Unknown log level " + std::to_string(level));
+    }
+    handle->logLevel = pfwLevel;
+    if (handle->pfw != nullptr) {
+        handle->pfw->setLogLevel(pfwLevel);
+    }
+    return status.success();
+}
+
+PfwLogLevel pfwGetLogLevel(const PfwHandler *handle)
+{
+    using Level = CParameterMgrPlatformConnector::LogLevel;
+    switch (handle->logLevel) {
+    case Level::debug:
+        return pfwLogDebug;
+    case Level::info:
+        return pfwLogInfo;
+    case Level::warning:
+        break;
+    }
+    return pfwLogWarning;
+}
+
 const char *pfwGetLastError(const PfwHandler *handle)
 {
     return handle->lastStatus.msg().c_str();
@@ -293,6 +340,20 @@ bool pfwApplyConfigurations(const PfwHandler *handle)
     return status.success();
 }
 
+const char *pfwGetMetrics(const PfwHandler *handle)
+{
+    Status &status = handle->lastStatus;
+    if (handle->pfw == nullptr) {
+        status.failure("Can not get metrics as the parameter framework is not started.");
+        return nullptr;
+    }
+    std::ostringstream metrics;
+    handle->pfw->writeMetrics(metrics, true);
+    handle->metrics = metrics.str();
+    status.success();
+    return handle->metrics.c_str();
+}
+
 ///////////////////////////////
 /////// Parameter access //////
 ///////////////////////////////
@@ -86,7 +86,8 @@ typedef struct PfwHandler_ PfwHandler;
 /** Pfw log level for the callback. */
 typedef enum {
     pfwLogInfo = 55, //< Random value to avoid unfortunate mismatch.
-    pfwLogWarning
+    pfwLogWarning,
+    pfwLogDebug //< Only used as a minimum level, debug lines are logged as pfwLogInfo.
 } PfwLogLevel;
 
 /** Type of the parameter framework log callback.
@@ -162,6 +163,21 @@ CPARAMETER_EXPORT
 bool pfwStart(PfwHandler *handle, const char *configPath, const PfwCriterion criteria[],
               size_t criterionNb, const PfwLogger *logger) NONNULL_(1, 2, 3) USERESULT;
 
+/** Set the minimum level of the lines provided to the logger callback.
+  * Lines below this level are discarded before being formatted.
+  * Can be called before or after pfwStart, the default level is pfwLogInfo.
+  * @param[in] handle @see PfwHandler
+  * @param[in] level The minimum level to log, from the most to the least verbose:
+  *                  pfwLogDebug, pfwLogInfo, pfwLogWarning.
+  * @return true on success, false on unknown level.
+  */
+CPARAMETER_EXPORT
+bool pfwSetLogLevel(PfwHandler *handle, PfwLogLevel level) NONNULL USERESULT;
+
+/** @return the minimum level of the lines provided to the logger callback. */
+CPARAMETER_EXPORT
+PfwLogLevel pfwGetLogLevel(const PfwHandler *handle) NONNULL USERESULT;
+
 /** @return a string describing the last call result.
   * If the last pfw function call succeeded, return an empty string.
   * If the last pfw function call failed, return a message explaining the error cause.
@@ -213,6 +229,19 @@ bool pfwGetCriterion(const PfwHandler *handle, const char name[], int *value) NO
 CPARAMETER_EXPORT
 bool pfwApplyConfigurations(const PfwHandler *handle) NONNULL USERESULT;
 
+/** Get the metrics of a started parameter framework.
+  * Counts configuration applications, evaluated domains, switched configurations,
+  * restored bytes and synchronizations per subsystem. Gives the latencies in
+  * microseconds of applications, synchronizations and parameter accesses.
+  *
+  * @param[in] handle @see PfwHandler
+  * @return the metrics as a JSON object on success, NULL on failure.
+  *         The pointer is invalidated by the next pfwGetMetrics call on the SAME
+  *         PfwHandler or by its destruction.
+  */
+CPARAMETER_EXPORT
+const char *pfwGetMetrics(const PfwHandler *handle) NONNULL USERESULT;
+
 ///////////////////////////////
 /////// Parameter access //////
 ///////////////////////////////
@@ -97,6 +97,7 @@ struct Test
         case pfwLogWarning:
             logLines += "Warning: ";
             break;
+        case pfwLogDebug:
         case pfwLogInfo:
             logLines += "Info: ";
         }
@@ -246,6 +247,17 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
         WHEN ("The pfw is started with default logger") {
             REQUIRE_SUCCESS(pfwStart(pfw, config, criteria, criterionNb, nullptr));
         }
+        WHEN ("The log level is changed before start") {
+            CHECK(pfwGetLogLevel(pfw) == pfwLogInfo);
+            REQUIRE_SUCCESS(pfwSetLogLevel(pfw, pfwLogWarning));
+            CHECK(pfwGetLogLevel(pfw) == pfwLogWarning);
+            REQUIRE_FAILURE(pfwSetLogLevel(pfw, static_cast<PfwLogLevel>(0)));
+            CHECK(pfwGetLogLevel(pfw) == pfwLogWarning);
+            THEN ("No info should be logged on start") {
+                REQUIRE_SUCCESS(pfwStart(pfw, config, criteria, criterionNb, &logger));
+                CHECK(logLines.find("Info: ") == std::string::npos);
+            }
+        }
 
         WHEN ("Get criterion of a stopped pfw") {
             int value;
@@ -257,6 +269,9 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
         WHEN ("Commit criteria of a stopped pfw") {
             REQUIRE_FAILURE(pfwApplyConfigurations(pfw));
         }
+        WHEN ("Get metrics of a stopped pfw") {
+            REQUIRE_FAILURE(pfwGetMetrics(pfw) != nullptr);
+        }
 
         WHEN ("Bind parameter with a stopped pfw") {
             REQUIRE(pfwBindParameter(pfw, intParameterPath) == NULL);
@@ -310,6 +325,14 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
             WHEN ("Commit criteria of a started pfw") {
                 REQUIRE_SUCCESS(pfwApplyConfigurations(pfw));
             }
+            WHEN ("Get metrics of a started pfw") {
+                const char *metrics = pfwGetMetrics(pfw);
+                REQUIRE_SUCCESS(metrics != nullptr);
+                THEN ("They should be a JSON object counting the initial application") {
+                    std::string json = metrics;
+                    CHECK(json.find("{\"counters\":{\"applies\":1,") == 0);
+                }
+            }
             WHEN ("Bind a non existing parameter") {
                 REQUIRE_FAILURE(pfwBindParameter(pfw, "do/not/exist") != nullptr);
             }
@@ -30,6 +30,7 @@
 #include "AreaConfiguration.h"
 #include "ConfigurableElement.h"
 #include "ConfigurationAccessContext.h"
+#include "Metrics.h"
 #include <assert.h>
 
 CAreaConfiguration::CAreaConfiguration(const CConfigurableElement *pConfigurableElement,
@@ -62,6 +63,11 @@ bool CAreaConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSy
 
     copyTo(pMainBlackboard, _pConfigurableElement->getOffset());
 
+    auto *metrics = core::metrics::Registry::current();
+    if (metrics != nullptr) {
+        metrics->count(core::metrics::Registry::Counter::bytesRestored, _blackboard.getSize());
+    }
+
     // Synchronize if required
     return !bSync || _pSyncerSet->sync(*pMainBlackboard, false, errors);
 }
@@ -143,21 +143,21 @@ bool CArrayParameter::access(std::vector<bool> &abValues, bool bSet,
 bool CArrayParameter::access(std::vector<uint32_t> &auiValues, bool bSet,
                              CParameterAccessContext &parameterAccessContext) const
 {
-    return accessValues(auiValues, bSet, parameterAccessContext);
+    return accessArray(auiValues, bSet, parameterAccessContext);
 }
 
 // Signed Integer Access
 bool CArrayParameter::access(std::vector<int32_t> &aiValues, bool bSet,
                              CParameterAccessContext &parameterAccessContext) const
 {
-    return accessValues(aiValues, bSet, parameterAccessContext);
+    return accessArray(aiValues, bSet, parameterAccessContext);
 }
 
 // Double Access
 bool CArrayParameter::access(std::vector<double> &adValues, bool bSet,
                              CParameterAccessContext &parameterAccessContext) const
 {
-    return accessValues(adValues, bSet, parameterAccessContext);
+    return accessArray(adValues, bSet, parameterAccessContext);
 }
 
 // String Access
@@ -167,6 +167,43 @@ bool CArrayParameter::access(std::vector<string> &astrValues, bool bSet,
     return accessValues(astrValues, bSet, parameterAccessContext);
 }
 
+// Bulk array access
+bool CArrayParameter::setArrayValues(const uint32_t *auiValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doSetArray(auiValues, count, parameterAccessContext);
+}
+
+bool CArrayParameter::getArrayValues(uint32_t *auiValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doGetArray(auiValues, count, parameterAccessContext);
+}
+
+bool CArrayParameter::setArrayValues(const int32_t *aiValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doSetArray(aiValues, count, parameterAccessContext);
+}
+
+bool CArrayParameter::getArrayValues(int32_t *aiValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doGetArray(aiValues, count, parameterAccessContext);
+}
+
+bool CArrayParameter::setArrayValues(const double *adValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doSetArray(adValues, count, parameterAccessContext);
+}
+
+bool CArrayParameter::getArrayValues(double *adValues, size_t count,
+                                     CParameterAccessContext &parameterAccessContext) const
+{
+    return doGetArray(adValues, count, parameterAccessContext);
+}
+
 // Dump
 string CArrayParameter::logValue(CParameterAccessContext &context) const
 {
@@ -254,8 +291,7 @@ bool CArrayParameter::setValues(size_t uiStartIndex, size_t offset, const string
     // Deal with value(s)
     Tokenizer tok(strValue, Tokenizer::defaultDelimiters + ",");
 
-    std::vector<string> astrValues = tok.split();
-    size_t nbValues = astrValues.size();
+    size_t nbValues = tok.remaining();
 
     // Check number of provided values
     if (nbValues + uiStartIndex > getArrayLength()) {
@@ -271,9 +307,12 @@ bool CArrayParameter::setValues(size_t uiStartIndex, size_t offset, const string
     size_t size = getSize();
     offset += uiStartIndex * size;
 
-    for (valueIndex = 0; valueIndex < nbValues; valueIndex++) {
+    // Storage reused by all values
+    string strItemValue;
+
+    for (valueIndex = 0; tok.next(strItemValue); valueIndex++) {
 
-        if (!doSet(astrValues[valueIndex], offset, parameterAccessContext)) {
+        if (!doSet(strItemValue, offset, parameterAccessContext)) {
 
             // Append parameter path to error
             parameterAccessContext.appendToError(" " + getPath() + "/" +
@@ -397,6 +436,63 @@ bool CArrayParameter::getValues(std::vector<type> &values,
     return true;
 }
 
+template <typename type>
+bool CArrayParameter::doSetArray(const type *values, size_t count,
+                                 CParameterAccessContext &parameterAccessContext) const
+{
+    assert(count == getArrayLength());
+
+    CParameterBlackboard *pBlackboard = parameterAccessContext.getParameterBlackboard();
+
+    // Convert and write the whole array at once
+    if (!static_cast<const CParameterType *>(getTypeElement())
+             ->bulkToBlackboard(values, count,
+                                pBlackboard->getLocation(getOffset(), getFootPrint()),
+                                parameterAccessContext)) {
+
+        appendParameterPathToError(parameterAccessContext);
+        return false;
+    }
+    if (!sync(parameterAccessContext)) {
+
+        appendParameterPathToError(parameterAccessContext);
+        return false;
+    }
+    return true;
+}
+
+template <typename type>
+bool CArrayParameter::doGetArray(type *values, size_t count,
+                                 CParameterAccessContext &parameterAccessContext) const
+{
+    assert(count == getArrayLength());
+
+    const CParameterBlackboard *pBlackboard = parameterAccessContext.getParameterBlackboard();
+
+    if (!static_cast<const CParameterType *>(getTypeElement())
+             ->bulkFromBlackboard(values, count,
+                                  pBlackboard->getLocation(getOffset(), getFootPrint()),
+                                  parameterAccessContext)) {
+
+        appendParameterPathToError(parameterAccessContext);
+        return false;
+    }
+    return true;
+}
+
+template <typename type>
+bool CArrayParameter::accessArray(std::vector<type> &values, bool bSet,
+                                  CParameterAccessContext &parameterAccessContext) const
+{
+    if (bSet) {
+
+        return doSetArray(values.data(), values.size(), parameterAccessContext);
+    }
+    values.resize(getArrayLength());
+
+    return doGetArray(values.data(), values.size(), parameterAccessContext);
+}
+
 template <typename type>
 bool CArrayParameter::doSet(type value, size_t offset,
                             CParameterAccessContext &parameterAccessContext) const
@@ -52,6 +52,20 @@ public:
     bool access(std::vector<std::string> &astrValues, bool bSet,
                 CParameterAccessContext &parameterAccessContext) const final;
 
+    /// Bulk array access
+    bool setArrayValues(const uint32_t *auiValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+    bool getArrayValues(uint32_t *auiValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+    bool setArrayValues(const int32_t *aiValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+    bool getArrayValues(int32_t *aiValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+    bool setArrayValues(const double *adValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+    bool getArrayValues(double *adValues, size_t count,
+                        CParameterAccessContext &parameterAccessContext) const final;
+
 protected:
     // User set/get
     bool accessValue(CPathNavigator &pathNavigator, std::string &strValue, bool bSet,
@@ -97,6 +111,17 @@ private:
     template <typename type>
     bool getValues(std::vector<type> &values,
                    CParameterAccessContext &parameterAccessContext) const;
+    /** Convert the whole array in one pass, see CParameterType::bulkToBlackboard */
+    template <typename type>
+    bool doSetArray(const type *values, size_t count,
+                    CParameterAccessContext &parameterAccessContext) const;
+    template <typename type>
+    bool doGetArray(type *values, size_t count,
+                    CParameterAccessContext &parameterAccessContext) const;
+    /** Bulk access through a std::vector */
+    template <typename type>
+    bool accessArray(std::vector<type> &values, bool bSet,
+                     CParameterAccessContext &parameterAccessContext) const;
     template <typename type>
     bool doSet(type value, size_t offset, CParameterAccessContext &parameterAccessContext) const;
     template <typename type>
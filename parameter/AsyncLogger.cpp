@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "AsyncLogger.h"
+
+#include <cstdint>
+
+namespace core
+{
+namespace log
+{
+
+AsyncLogger::AsyncLogger(ILogger *logger, size_t capacity) : mLogger(logger)
+{
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mMask = size - 1;
+    mEntries.reset(new Entry[size]);
+    for (size_t position = 0; position < size; ++position) {
+        mEntries[position].sequence.store(position, std::memory_order_relaxed);
+    }
+    mDrainer = std::thread(&AsyncLogger::drain, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWakeUp.notify_one();
+    mDrainer.join();
+}
+
+void AsyncLogger::info(const std::string &strLog)
+{
+    push(false, strLog);
+}
+
+void AsyncLogger::warning(const std::string &strLog)
+{
+    push(true, strLog);
+}
+
+size_t AsyncLogger::getDroppedCount() const
+{
+    return mDropped.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::setLogger(ILogger *logger)
+{
+    flush();
+
+    std::lock_guard<std::mutex> lock(mLoggerMutex);
+    mLogger = logger;
+}
+
+void AsyncLogger::flush()
+{
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFlushed.wait(lock, [this, position] { return mForwardedPosition >= position; });
+}
+
+void AsyncLogger::push(bool isWarning, const std::string &log)
+{
+    // Bounded multi-producer queue: reserve a position then fill its slot
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Entry *entry;
+    while (true) {
+        entry = &mEntries[position & mMask];
+        size_t sequence = entry->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                       std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // The slot has not been read since the previous lap: the buffer is full
+            mDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    entry->isWarning = isWarning;
+    entry->log = log;
+    entry->sequence.store(position + 1, std::memory_order_release);
+
+    // Only take the lock if the drain thread sleeps, pairs with the fence in drain
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mDrainerWaiting.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWakeUp.notify_one();
+    }
+}
+
+bool AsyncLogger::pop(bool &isWarning, std::string &log)
+{
+    Entry &entry = mEntries[mDequeuePosition & mMask];
+    if (entry.sequence.load(std::memory_order_acquire) != mDequeuePosition + 1) {
+        return false;
+    }
+    isWarning = entry.isWarning;
+    log.swap(entry.log);
+    // Make the slot writable for the next lap
+    entry.sequence.store(mDequeuePosition + mMask + 1, std::memory_order_release);
+    ++mDequeuePosition;
+    return true;
+}
+
+bool AsyncLogger::empty() const
+{
+    const Entry &entry = mEntries[mDequeuePosition & mMask];
+    return entry.sequence.load(std::memory_order_acquire) != mDequeuePosition + 1;
+}
+
+void AsyncLogger::drain()
+{
+    bool isWarning;
+    std::string log;
+    while (true) {
+
+        while (pop(isWarning, log)) {
+            std::lock_guard<std::mutex> loggerLock(mLoggerMutex);
+            if (mLogger == nullptr) {
+                continue;
+            }
+            if (isWarning) {
+                mLogger->warning(log);
+            } else {
+                mLogger->info(log);
+            }
+        }
+
+        size_t dropped = mDropped.load(std::memory_order_relaxed);
+        if (dropped != mReportedDropped) {
+            std::lock_guard<std::mutex> loggerLock(mLoggerMutex);
+            if (mLogger != nullptr) {
+                mLogger->warning(std::to_string(dropped - mReportedDropped) +
+                                 " log(s) dropped because the asynchronous log buffer was full");
+            }
+            mReportedDropped = dropped;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mForwardedPosition = mDequeuePosition;
+        mFlushed.notify_all();
+        mDrainerWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (empty()) {
+            // Only stop once everything has been forwarded
+            if (mStop) {
+                return;
+            }
+            mWakeUp.wait(lock);
+        }
+        mDrainerWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace log
+} // namespace core
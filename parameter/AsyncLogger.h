@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "log/ILogger.h"
+#include "NonCopyable.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace core
+{
+namespace log
+{
+
+/** Logger which forwards logs to another one from a background thread
+ *
+ * Logs are pushed without locking in a bounded ring buffer, so that the logging
+ * thread never waits for a slow client logger. Logs which do not fit in the buffer
+ * are dropped, counted and reported by a warning once the buffer has been drained.
+ * All pending logs are forwarded before destruction.
+ *
+ * Any thread can log, the wrapped logger is only called from the drain thread.
+ */
+class AsyncLogger : public ILogger, private utility::NonCopyable
+{
+public:
+    /**
+     * @param[in] logger the logger to forward logs to, nullptr to discard them
+     * @param[in] capacity maximum number of pending logs, rounded up to a power of 2
+     */
+    AsyncLogger(ILogger *logger, size_t capacity);
+
+    /** Forward all pending logs then stop the drain thread
+     *
+     * No log may be pushed during or after destruction.
+     */
+    virtual ~AsyncLogger();
+
+    void info(const std::string &strLog) override;
+    void warning(const std::string &strLog) override;
+
+    /** @return the number of logs dropped because the buffer was full */
+    size_t getDroppedCount() const;
+
+    /** Forward the pending logs to the current logger, then the next ones to another one
+     *
+     * Once this returns, the previous logger is not called any more and can be destroyed.
+     * Must not be called from the logger itself.
+     *
+     * @param[in] logger the logger to forward the next logs to, nullptr to discard them
+     */
+    void setLogger(ILogger *logger);
+
+private:
+    /** Ring buffer slot */
+    struct Entry
+    {
+        /** Position of the entry when it can be written, position + 1 once written */
+        std::atomic<size_t> sequence;
+        bool isWarning;
+        std::string log;
+    };
+
+    /** Push a log in the buffer and wake up the drain thread if needed
+     *
+     * @param[in] isWarning the log canal
+     * @param[in] log the log to push
+     */
+    void push(bool isWarning, const std::string &log);
+
+    /** Pop the oldest log, only called from the drain thread
+     *
+     * @param[out] isWarning the log canal
+     * @param[out] log the popped log
+     * @return false if the buffer is empty
+     */
+    bool pop(bool &isWarning, std::string &log);
+
+    /** @return true if no log is ready to be popped */
+    bool empty() const;
+
+    /** Drain thread loop */
+    void drain();
+
+    /** Wait until all the logs pushed before the call have been forwarded */
+    void flush();
+
+    /** Logger the logs are forwarded to, protected by mLoggerMutex */
+    ILogger *mLogger;
+    std::mutex mLoggerMutex;
+
+    /** Ring buffer and position mask */
+    std::unique_ptr<Entry[]> mEntries;
+    size_t mMask;
+
+    /** Next position to write, shared by the logging threads */
+    std::atomic<size_t> mEnqueuePosition{0};
+
+    /** Next position to read, only used by the drain thread */
+    size_t mDequeuePosition{0};
+
+    /** Number of logs dropped and number of them already reported */
+    std::atomic<size_t> mDropped{0};
+    size_t mReportedDropped{0};
+
+    /** Drain thread synchronisation, only used to sleep when the buffer is empty */
+    std::mutex mMutex;
+    std::condition_variable mWakeUp;
+    std::atomic<bool> mDrainerWaiting{false};
+    bool mStop{false};
+
+    /** Position up to which logs have been forwarded, to wake up flush */
+    size_t mForwardedPosition{0};
+    std::condition_variable mFlushed;
+
+    std::thread mDrainer;
+};
+
+} // namespace log
+} // namespace core
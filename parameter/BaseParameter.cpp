@@ -143,6 +143,46 @@ bool CBaseParameter::access(std::vector<double> & /*abValues*/, bool /*bSet*/,
     return false;
 }
 
+// Bulk array access
+bool CBaseParameter::setArrayValues(const uint32_t * /*auiValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+bool CBaseParameter::getArrayValues(uint32_t * /*auiValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+
+bool CBaseParameter::setArrayValues(const int32_t * /*aiValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+bool CBaseParameter::getArrayValues(int32_t * /*aiValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+
+bool CBaseParameter::setArrayValues(const double * /*adValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+bool CBaseParameter::getArrayValues(double * /*adValues*/, size_t /*count*/,
+                                    CParameterAccessContext &parameterAccessContext) const
+{
+    parameterAccessContext.setError("Unsupported conversion");
+    return false;
+}
+
 // String Access
 bool CBaseParameter::access(string &strValue, bool bSet,
                             CParameterAccessContext &parameterAccessContext) const
@@ -84,6 +84,29 @@ public:
     virtual bool access(std::vector<std::string> &astrValues, bool bSet,
                         CParameterAccessContext &parameterAccessContext) const;
 
+    /** Bulk array access through caller-owned buffers
+     *
+     * @param[in,out] values the buffer to read from (set) or write to (get)
+     * @param[in] count the buffer length, expected to be the parameter array length
+     * @{
+     */
+    // Integer
+    virtual bool setArrayValues(const uint32_t *auiValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    virtual bool getArrayValues(uint32_t *auiValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    // Signed Integer
+    virtual bool setArrayValues(const int32_t *aiValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    virtual bool getArrayValues(int32_t *aiValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    // Double
+    virtual bool setArrayValues(const double *adValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    virtual bool getArrayValues(double *adValues, size_t count,
+                                CParameterAccessContext &parameterAccessContext) const;
+    /** @} */
+
     void structureToXml(CXmlElement &xmlElement,
                         CXmlSerializingContext &serializingContext) const final;
 
@@ -158,18 +158,14 @@ void CBitParameterType::fromBlackboard(string &strValue, const uint64_t &uiValue
 {
     uint64_t uiConvertedValue = (uiValue & getMask()) >> _bitPos;
 
-    // Format
-    std::ostringstream strStream;
-
     // Take care of format
     if (parameterAccessContext.valueSpaceIsRaw() && parameterAccessContext.outputRawFormatIsHex()) {
 
-        strStream << "0x" << std::hex << std::uppercase;
-    }
-
-    strStream << uiConvertedValue;
+        strValue = utility::toHexadecimal(uiConvertedValue);
+    } else {
 
-    strValue = strStream.str();
+        strValue = std::to_string(uiConvertedValue);
+    }
 }
 
 // Value access
@@ -34,6 +34,8 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
+#include "Tracer.h"
+#include "Metrics.h"
 #include "Utility.h"
 #include "AlwaysAssert.hpp"
 #include <cassert>
@@ -41,6 +43,7 @@
 #define base CElement
 
 using std::string;
+using core::metrics::Registry;
 
 CConfigurableDomain::CConfigurableDomain(const string &strName) : base(strName)
 {
@@ -522,8 +525,11 @@ bool CConfigurableDomain::split(CConfigurableElement *pConfigurableElement, core
 // different from the last applied configuration
 const CDomainConfiguration *CConfigurableDomain::getPendingConfiguration() const
 {
-    const CDomainConfiguration *pApplicableDomainConfiguration =
-        findApplicableDomainConfiguration();
+    const CDomainConfiguration *pApplicableDomainConfiguration;
+    {
+        PFW_TRACE_SPAN("evaluate", getName());
+        pApplicableDomainConfiguration = findApplicableDomainConfiguration();
+    }
 
     if (pApplicableDomainConfiguration) {
 
@@ -540,7 +546,7 @@ const CDomainConfiguration *CConfigurableDomain::getPendingConfiguration() const
 
 // Configuration application if required
 void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet,
-                                bool bForce, std::string &strInfo) const
+                                bool bForce, std::string *info, core::Results *errors) const
 {
     // Apply configuration only if the blackboard will
     // be synchronized either now or by syncerSet.
@@ -553,8 +559,15 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
         // Force a configuration restore by forgetting about last applied configuration
         _pLastAppliedConfiguration = nullptr;
     }
-    const CDomainConfiguration *pApplicableDomainConfiguration =
-        findApplicableDomainConfiguration();
+    const CDomainConfiguration *pApplicableDomainConfiguration;
+    {
+        PFW_TRACE_SPAN("evaluate", getName());
+        pApplicableDomainConfiguration = findApplicableDomainConfiguration();
+    }
+    Registry *metrics = Registry::current();
+    if (metrics != nullptr) {
+        metrics->count(Registry::Counter::domainsEvaluated);
+    }
 
     if (pApplicableDomainConfiguration) {
 
@@ -562,14 +575,25 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
         if (!_pLastAppliedConfiguration ||
             _pLastAppliedConfiguration != pApplicableDomainConfiguration) {
 
-            strInfo = "Applying configuration '" + pApplicableDomainConfiguration->getName() +
-                      "' from domain '" + getName() + "'";
+            if (info != nullptr) {
+
+                *info = "Applying configuration '" + pApplicableDomainConfiguration->getName() +
+                        "' from domain '" + getName() + "'";
+            }
 
             // Check if we need to synchronize during restore
             bool bSync = !pSyncerSet && _bSequenceAware;
 
+            if (metrics != nullptr) {
+                metrics->count(Registry::Counter::configurationsSwitched);
+            }
+
             // Do the restore
-            pApplicableDomainConfiguration->restore(pParameterBlackboard, bSync, nullptr);
+            {
+                PFW_TRACE_SPAN("restore",
+                               getName() + "/" + pApplicableDomainConfiguration->getName());
+                pApplicableDomainConfiguration->restore(pParameterBlackboard, bSync, errors);
+            }
 
             // Record last applied configuration
             _pLastAppliedConfiguration = pApplicableDomainConfiguration;
@@ -852,6 +876,11 @@ string CConfigurableDomain::getLastAppliedConfigurationName() const
     return "<none>";
 }
 
+const CDomainConfiguration *CConfigurableDomain::getLastAppliedConfiguration() const
+{
+    return _pLastAppliedConfiguration;
+}
+
 // Pending configuration
 string CConfigurableDomain::getPendingConfigurationName() const
 {
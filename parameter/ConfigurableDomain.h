@@ -94,6 +94,9 @@ public:
     // Last applied configuration name
     std::string getLastAppliedConfigurationName() const;
 
+    /** @return the last applied configuration, nullptr if none */
+    const CDomainConfiguration *getLastAppliedConfiguration() const;
+
     // Pending configuration name
     std::string getPendingConfigurationName() const;
 
@@ -137,10 +140,12 @@ public:
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] pSyncerSet pointer to the set containing application syncers
      * @param[in] bForced boolean used to force configuration application
-     * @param[out] info string containing useful information we can provide to client
+     * @param[out] info if not null, receives useful information we can provide to client
+     * @param[out] errors if not null, receives the errors of the synchronization
+     *                    made along the application
      */
     void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet, bool bForced,
-               std::string &info) const;
+               std::string *info, core::Results *errors = nullptr) const;
 
     // Return applicable configuration validity for given configurable element
     bool isApplicableConfigurationValid(const CConfigurableElement *pConfigurableElement) const;
@@ -31,10 +31,12 @@
 #include "ConfigurableDomains.h"
 #include "ConfigurableDomain.h"
 #include "ConfigurableElement.h"
+#include "DomainConfiguration.h"
 
 #define base CElement
 
 using std::string;
+using std::vector;
 
 string CConfigurableDomains::getKind() const
 {
@@ -63,7 +65,7 @@ void CConfigurableDomains::validate(const CParameterBlackboard *pMainBlackboard)
 
 // Configuration application if required
 void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
-                                 bool bForce, core::Results &infos) const
+                                 bool bForce, core::Results *infos, core::Results *errors) const
 {
     /// Delegate to domains
 
@@ -77,14 +79,15 @@ void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSy
 
         std::string info;
         // Apply and collect syncers when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, &syncerSet, bForce, info);
+        pChildConfigurableDomain->apply(pParameterBlackboard, &syncerSet, bForce,
+                                        infos != nullptr ? &info : nullptr);
 
         if (!info.empty()) {
-            infos.push_back(info);
+            infos->push_back(info);
         }
     }
     // Synchronize those collected syncers
-    syncerSet.sync(*pParameterBlackboard, false, nullptr);
+    syncerSet.sync(*pParameterBlackboard, false, errors);
 
     // Then deal with domains that need to synchronize along apply
     for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
@@ -94,9 +97,10 @@ void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSy
 
         std::string info;
         // Apply and synchronize when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce, info);
+        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce,
+                                        infos != nullptr ? &info : nullptr, errors);
         if (!info.empty()) {
-            infos.push_back(info);
+            infos->push_back(info);
         }
     }
 }
@@ -532,6 +536,19 @@ void CConfigurableDomains::listLastAppliedConfigurations(string &strResult) cons
     }
 }
 
+void CConfigurableDomains::listLastAppliedConfigurations(vector<string> &lastApplied) const
+{
+    for (size_t child = 0; child < getNbChildren(); child++) {
+
+        auto domain = static_cast<const CConfigurableDomain *>(getChild(child));
+        const CDomainConfiguration *configuration = domain->getLastAppliedConfiguration();
+
+        if (configuration != nullptr) {
+            lastApplied.push_back(domain->getName() + "/" + configuration->getName());
+        }
+    }
+}
+
 // Configurable element - domain association
 bool CConfigurableDomains::addConfigurableElementToDomain(
     const string &domainName, CConfigurableElement *element,
@@ -33,6 +33,7 @@
 #include "Results.h"
 #include <set>
 #include <string>
+#include <vector>
 
 class CParameterBlackboard;
 class CConfigurableElement;
@@ -134,6 +135,13 @@ public:
     // Last applied configurations
     void listLastAppliedConfigurations(std::string &strResult) const;
 
+    /** Gather the last applied configurations, as "<domain>/<configuration>"
+     *
+     * @param[out] lastApplied the configurations, in domain order, the domains which did not
+     *                         apply any being skipped
+     */
+    void listLastAppliedConfigurations(std::vector<std::string> &lastApplied) const;
+
     /** Associate a configurable element to a domain
      *
      * @param[in] domainName the domain name
@@ -171,10 +179,11 @@ public:
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] syncerSet the set containing application syncers
      * @param[in] bForce boolean used to force configuration application
-     * @param[out] infos useful information we can provide to client
+     * @param[out] infos if not null, receives useful information we can provide to client
+     * @param[out] errors if not null, receives the synchronization errors
      */
     void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet, bool bForce,
-               core::Results &infos) const;
+               core::Results *infos, core::Results *errors = nullptr) const;
 
     // Class kind
     std::string getKind() const override;
@@ -81,9 +81,9 @@ bool CElement::init(string &strError)
     return true;
 }
 
-string CElement::dumpContent(utility::ErrorContext &errorContext, const size_t depth) const
+void CElement::dumpContent(std::ostream &output, utility::ErrorContext &errorContext,
+                           const size_t depth) const
 {
-    string output;
     string strIndent;
 
     // Level
@@ -94,12 +94,12 @@ string CElement::dumpContent(utility::ErrorContext &errorContext, const size_t d
         strIndent += "    ";
     }
     // Type
-    output += strIndent + "- " + getKind();
+    output << strIndent << "- " << getKind();
 
     // Name
     if (!_strName.empty()) {
 
-        output += ": " + getName();
+        output << ": " << getName();
     }
 
     // Value
@@ -107,17 +107,15 @@ string CElement::dumpContent(utility::ErrorContext &errorContext, const size_t d
 
     if (!strValue.empty()) {
 
-        output += " = " + strValue;
+        output << " = " << strValue;
     }
 
-    output += "\n";
+    output << "\n";
 
     for (CElement *pChild : _childArray) {
 
-        output += pChild->dumpContent(errorContext, depth + 1);
+        pChild->dumpContent(output, errorContext, depth + 1);
     }
-
-    return output;
 }
 
 // Element properties
@@ -340,24 +338,21 @@ void CElement::listChildren(string &strChildList) const
     }
 }
 
-string CElement::listQualifiedPaths(bool bDive, size_t level) const
+void CElement::listQualifiedPaths(std::ostream &output, bool bDive, size_t level) const
 {
-    string strResult;
-
     // Dive Will cause only leaf nodes to be printed
     if (!bDive || !getNbChildren()) {
 
-        strResult = getQualifiedPath() + "\n";
+        output << getQualifiedPath() << "\n";
     }
 
     if (bDive || !level) {
         // Get list of children paths
         for (CElement *pChild : _childArray) {
 
-            strResult += pChild->listQualifiedPaths(bDive, level + 1);
+            pChild->listQualifiedPaths(output, bDive, level + 1);
         }
     }
-    return strResult;
 }
 
 void CElement::listChildrenPaths(string &strChildList) const
@@ -31,6 +31,7 @@
 
 #include "parameter_export.h"
 
+#include <ostream>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -70,7 +71,7 @@ public:
     void addChild(CElement *pChild);
     bool removeChild(CElement *pChild);
     void listChildren(std::string &strChildList) const;
-    std::string listQualifiedPaths(bool bDive, size_t level = 0) const;
+    void listQualifiedPaths(std::ostream &output, bool bDive, size_t level = 0) const;
     void listChildrenPaths(std::string &strChildPathList) const;
 
     // Hierarchy query
@@ -127,7 +128,8 @@ public:
                                CXmlSerializingContext &serializingContext) const;
 
     // Content structure dump
-    std::string dumpContent(utility::ErrorContext &errorContext, const size_t depth = 0) const;
+    void dumpContent(std::ostream &output, utility::ErrorContext &errorContext,
+                     const size_t depth = 0) const;
 
     // Element properties
     virtual void showProperties(std::string &strResult) const;
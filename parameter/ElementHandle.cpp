@@ -40,6 +40,7 @@
 using std::string;
 using std::mutex;
 using std::lock_guard;
+using core::metrics::Registry;
 
 /** @return 0 by default, ie for non overloaded types. */
 template <class T>
@@ -196,6 +197,8 @@ bool ElementHandle::setAsBytes(const std::vector<uint8_t> &bytesValue, std::stri
 template <class T>
 bool ElementHandle::setAs(const T value, string &error) const
 {
+    Registry::Scope metricsScope(mParameterMgr._metrics, Registry::Latency::set);
+
     if (not checkSetValidity(getUserInputSize(value), error)) {
         return false;
     }
@@ -223,6 +226,8 @@ bool ElementHandle::setAs(const T value, string &error) const
 template <class T>
 bool ElementHandle::getAs(T &value, string &error) const
 {
+    Registry::Scope metricsScope(mParameterMgr._metrics, Registry::Latency::get);
+
     if (not checkGetValidity(isVector<T>::value, error)) {
         return false;
     }
@@ -237,6 +242,61 @@ bool ElementHandle::getAs(T &value, string &error) const
     return parameter.access(value, false, parameterAccessContext);
 }
 
+template <class T>
+bool ElementHandle::setAsBuffer(const T *values, size_t length, string &error) const
+{
+    Registry::Scope metricsScope(mParameterMgr._metrics, Registry::Latency::set);
+
+    if (not checkSetValidity(length, error)) {
+        return false;
+    }
+    if (length == 0) {
+        error = "Can not set \"" + getPath() + "\" from an empty buffer";
+        return false;
+    }
+    // Safe downcast thanks to isParameter check in checkSetValidity
+    auto &parameter = static_cast<CBaseParameter &>(mElement);
+
+    // When in tuning mode, silently skip "set" requests
+    if (mParameterMgr.tuningModeOn()) {
+
+        return true;
+    }
+
+    CParameterAccessContext parameterAccessContext(error, mParameterMgr.getParameterBlackboard());
+
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+
+    return parameter.setArrayValues(values, length, parameterAccessContext);
+}
+
+template <class T>
+bool ElementHandle::getAsBuffer(T *values, size_t length, string &error) const
+{
+    Registry::Scope metricsScope(mParameterMgr._metrics, Registry::Latency::get);
+
+    if (not checkGetValidity(true, error)) {
+        return false;
+    }
+    if (length != getArrayLength()) {
+
+        using std::to_string;
+        error = "Array length mismatch for \"" + getPath() + "\", expected: " +
+                to_string(getArrayLength()) + ", got: " + to_string(length);
+        return false;
+    }
+    // Safe downcast thanks to isParameter check in checkGetValidity
+    auto &parameter = static_cast<const CBaseParameter &>(mElement);
+
+    // Ensure we're safe against blackboard foreign access
+    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+
+    CParameterAccessContext parameterAccessContext(error, mParameterMgr.getParameterBlackboard());
+
+    return parameter.getArrayValues(values, length, parameterAccessContext);
+}
+
 // Boolean access
 bool ElementHandle::setAsBoolean(bool value, string &error)
 {
@@ -321,6 +381,37 @@ bool ElementHandle::getAsDoubleArray(std::vector<double> &value, string &error)
     return getAs(value, error);
 }
 
+// Bulk array access
+bool ElementHandle::setAsIntegerBuffer(const uint32_t *values, size_t length, string &error)
+{
+    return setAsBuffer(values, length, error);
+}
+
+bool ElementHandle::getAsIntegerBuffer(uint32_t *values, size_t length, string &error) const
+{
+    return getAsBuffer(values, length, error);
+}
+
+bool ElementHandle::setAsSignedIntegerBuffer(const int32_t *values, size_t length, string &error)
+{
+    return setAsBuffer(values, length, error);
+}
+
+bool ElementHandle::getAsSignedIntegerBuffer(int32_t *values, size_t length, string &error) const
+{
+    return getAsBuffer(values, length, error);
+}
+
+bool ElementHandle::setAsDoubleBuffer(const double *values, size_t length, string &error)
+{
+    return setAsBuffer(values, length, error);
+}
+
+bool ElementHandle::getAsDoubleBuffer(double *values, size_t length, string &error) const
+{
+    return getAsBuffer(values, length, error);
+}
+
 // String Access
 bool ElementHandle::setAsString(const string &value, string &error)
 {
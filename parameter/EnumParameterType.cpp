@@ -31,6 +31,7 @@
 #include "EnumValuePair.h"
 #include "ParameterAccessContext.h"
 #include "convert.hpp"
+#include "Utility.h"
 
 #include <iomanip>
 
@@ -140,18 +141,11 @@ bool CEnumParameterType::fromBlackboard(string &userValue, const uint32_t &value
     // Take care of format
     if (ctx.valueSpaceIsRaw()) {
 
-        // Format
-        std::ostringstream sstream;
-
         // Numerical format requested
         if (ctx.outputRawFormatIsHex()) {
 
             // Hexa display with unecessary bits cleared out
-            sstream << "0x" << std::hex << std::uppercase
-                    << std::setw(static_cast<int>(getSize() * 2)) << std::setfill('0')
-                    << makeEncodable(value);
-
-            userValue = sstream.str();
+            userValue = utility::toHexadecimal(makeEncodable(value), getSize() * 2);
         } else {
             userValue = std::to_string(value);
         }
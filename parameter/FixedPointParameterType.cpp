@@ -193,24 +193,20 @@ bool CFixedPointParameterType::fromBlackboard(string &strValue, const uint32_t &
     // Check encodability
     assert(isEncodable(value, false));
 
-    // Format
-    std::ostringstream stream;
-
     // Raw formatting?
     if (parameterAccessContext.valueSpaceIsRaw()) {
         // Hexa formatting?
         if (parameterAccessContext.outputRawFormatIsHex()) {
             uint32_t data = static_cast<uint32_t>(value);
 
-            stream << "0x" << std::hex << std::uppercase
-                   << std::setw(static_cast<int>(getSize() * 2)) << std::setfill('0') << data;
+            strValue = utility::toHexadecimal(data, getSize() * 2);
         } else {
             int32_t data = value;
 
             // Sign extend
             signExtend(data);
 
-            stream << data;
+            strValue = std::to_string(data);
         }
     } else {
         int32_t data = value;
@@ -219,11 +215,10 @@ bool CFixedPointParameterType::fromBlackboard(string &strValue, const uint32_t &
         signExtend(data);
 
         // Conversion
-        stream << std::fixed << std::setprecision(_uiFractional) << binaryQnmToDouble(data);
+        strValue = utility::formatFloatingPoint(binaryQnmToDouble(data),
+                                                static_cast<int>(_uiFractional), true);
     }
 
-    strValue = stream.str();
-
     return true;
 }
 
@@ -267,6 +262,44 @@ bool CFixedPointParameterType::fromBlackboard(double &dUserValue, uint32_t uiVal
     return true;
 }
 
+// Bulk value access
+bool CFixedPointParameterType::bulkToBlackboard(
+    const double *adUserValues, size_t count, uint8_t *pData,
+    CParameterAccessContext &parameterAccessContext) const
+{
+    double dMin = 0;
+    double dMax = 0;
+    getRange(dMin, dMax);
+
+    // Check all values before writing any of them
+    if (!utility::kernels::inRange(adUserValues, count, dMin, dMax)) {
+
+        parameterAccessContext.setError("Value out of range");
+
+        return false;
+    }
+
+    // Beware this code works on little endian architectures only!
+    utility::kernels::doubleToQnm(adUserValues, count, getQnmFormat(), pData);
+
+    return true;
+}
+
+bool CFixedPointParameterType::bulkFromBlackboard(double *adUserValues, size_t count,
+                                                  const uint8_t *pData,
+                                                  CParameterAccessContext & /*ctx*/) const
+{
+    // Beware this code works on little endian architectures only!
+    utility::kernels::qnmToDouble(pData, count, getQnmFormat(), adUserValues);
+
+    return true;
+}
+
+utility::kernels::QnmFormat CFixedPointParameterType::getQnmFormat() const
+{
+    return {getSize(), _uiFractional, static_cast<uint32_t>(getSize() * 8 - getUtilSizeInBits())};
+}
+
 // Util size
 size_t CFixedPointParameterType::getUtilSizeInBits() const
 {
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "ParameterType.h"
+#include "ArrayKernels.hpp"
 
 #include <string>
 
@@ -62,6 +63,11 @@ public:
                       CParameterAccessContext &parameterAccessContext) const override;
     bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                         CParameterAccessContext &parameterAccessContext) const override;
+    // Bulk double
+    bool bulkToBlackboard(const double *adUserValues, size_t count, uint8_t *pData,
+                          CParameterAccessContext &parameterAccessContext) const override;
+    bool bulkFromBlackboard(double *adUserValues, size_t count, const uint8_t *pData,
+                            CParameterAccessContext &parameterAccessContext) const override;
 
     // Element properties
     void showProperties(std::string &strResult) const override;
@@ -153,6 +159,9 @@ private:
      */
     double binaryQnmToDouble(int32_t iValue) const;
 
+    /** @return the blackboard storage description used by bulk conversions */
+    utility::kernels::QnmFormat getQnmFormat() const;
+
     // Integral part in Q notation
     uint32_t _uiIntegral{0};
     // Fractional part in Q notation
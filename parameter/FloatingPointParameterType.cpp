@@ -34,9 +34,12 @@
 #include "ConfigurationAccessContext.h"
 #include <limits>
 #include <climits>
+#include <cinttypes>
+#include <cstdio>
 #include "convert.hpp"
 #include "Utility.h"
 #include "BinaryCopy.hpp"
+#include "ArrayKernels.hpp"
 
 using std::string;
 
@@ -206,27 +209,32 @@ bool CFloatingPointParameterType::fromBlackboard(
     string &strValue, const uint32_t &uiValue,
     CParameterAccessContext &parameterAccessContext) const
 {
-    std::ostringstream ostrStream;
-
     if (parameterAccessContext.valueSpaceIsRaw()) {
 
         if (parameterAccessContext.outputRawFormatIsHex()) {
 
-            ostrStream << std::showbase << std::hex << std::setw(static_cast<int>(getSize() * 2))
-                       << std::setfill('0');
-        }
+            // As std::showbase and std::hex: lowercase, no base for 0, padding before the base
+            char buffer[11];
+            snprintf(buffer, sizeof(buffer), "%#" PRIx32, uiValue);
+
+            strValue = buffer;
+            if (strValue.size() < getSize() * 2) {
 
-        ostrStream << uiValue;
+                strValue.insert(0, getSize() * 2 - strValue.size(), '0');
+            }
+        } else {
+
+            strValue = std::to_string(uiValue);
+        }
     } else {
 
         // Move from "raw memory" value space to real space
         auto fValue = utility::binaryCopy<float>(uiValue);
 
-        ostrStream << fValue;
+        // Default stream precision
+        strValue = utility::formatFloatingPoint(fValue, 6);
     }
 
-    strValue = ostrStream.str();
-
     return true;
 }
 
@@ -256,6 +264,28 @@ bool CFloatingPointParameterType::fromBlackboard(double &dUserValue, uint32_t ui
     return true;
 }
 
+bool CFloatingPointParameterType::bulkToBlackboard(
+    const double *adUserValues, size_t count, uint8_t *pData,
+    CParameterAccessContext &parameterAccessContext) const
+{
+    // Check all values before writing any of them
+    if (!utility::kernels::inFloatRange(adUserValues, count, _fMin, _fMax)) {
+
+        parameterAccessContext.setError("Value out of range");
+        return false;
+    }
+    utility::kernels::doubleToFloat(adUserValues, count, pData);
+    return true;
+}
+
+bool CFloatingPointParameterType::bulkFromBlackboard(double *adUserValues, size_t count,
+                                                     const uint8_t *pData,
+                                                     CParameterAccessContext & /*ctx*/) const
+{
+    utility::kernels::floatToDouble(pData, count, adUserValues);
+    return true;
+}
+
 bool CFloatingPointParameterType::checkValueAgainstRange(double dValue) const
 {
     // Check that dValue can safely be cast to a float
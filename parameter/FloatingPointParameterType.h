@@ -53,6 +53,10 @@ public:
                       CParameterAccessContext &parameterAccessContext) const override;
     bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                         CParameterAccessContext &parameterAccessContext) const override;
+    bool bulkToBlackboard(const double *adUserValues, size_t count, uint8_t *pData,
+                          CParameterAccessContext &parameterAccessContext) const override;
+    bool bulkFromBlackboard(double *adUserValues, size_t count, const uint8_t *pData,
+                            CParameterAccessContext &parameterAccessContext) const override;
 
     void showProperties(std::string &strResult) const override;
 
@@ -34,12 +34,15 @@
 #include "ParameterAccessContext.h"
 
 #include <convert.hpp>
+#include <ArrayKernels.hpp>
 
+#include <algorithm>
 #include <type_traits>
 #include <sstream>
 #include <string>
 #include <limits>
 #include <iomanip>
+#include <vector>
 
 namespace detail
 {
@@ -85,6 +88,115 @@ private:
         }
     }
 
+    template <class UserType>
+    bool doBulkToBlackboard(const UserType *userValues, size_t count, uint8_t *pData,
+                            CParameterAccessContext &parameterAccessContext) const
+    {
+        // Check all values before writing any of them
+        if (!utility::kernels::inRange(userValues, count, static_cast<UserType>(_min),
+                                       static_cast<UserType>(_max))) {
+
+            parameterAccessContext.setError("Value out of range");
+            return false;
+        }
+        utility::kernels::pack(userValues, count, sizeof(CType), pData);
+        return true;
+    }
+
+    template <class UserType>
+    void doBulkFromBlackboard(UserType *userValues, size_t count, const uint8_t *pData) const
+    {
+        // Unsigned users get the raw value, signed ones get it sign extended
+        utility::kernels::unpack(pData, count, sizeof(CType), userValues);
+    }
+
+    /** Integer able to hold any CType value, as handled by the kernels */
+    using RawType = typename std::conditional<isSigned, int32_t, uint32_t>::type;
+
+    /** Adapts user values chunk by chunk
+     *
+     * @param[in] pData where to write the adapted values, nullptr to only check them
+     * @return false if an adapted value is out of range
+     */
+    bool adaptToBlackboard(const CParameterAdaptation &adaptation, const double *adUserValues,
+                           size_t count, uint8_t *pData) const
+    {
+        using utility::kernels::chunkSize;
+        double adValues[chunkSize];
+        RawType aValues[chunkSize];
+
+        for (size_t first = 0; first < count; first += chunkSize) {
+
+            size_t length = std::min(chunkSize, count - first);
+
+            adaptation.fromUserValues(adUserValues + first, length, adValues);
+
+            if (!utility::kernels::inRange(adValues, length, static_cast<double>(_min),
+                                           static_cast<double>(_max))) {
+                return false;
+            }
+            if (pData != nullptr) {
+
+                utility::kernels::toInteger(adValues, length, aValues);
+                utility::kernels::pack(aValues, length, sizeof(CType),
+                                       pData + first * sizeof(CType));
+            }
+        }
+        return true;
+    }
+
+    void adaptFromBlackboard(const CParameterAdaptation &adaptation, double *adUserValues,
+                             size_t count, const uint8_t *pData) const
+    {
+        using utility::kernels::chunkSize;
+        RawType aValues[chunkSize];
+
+        for (size_t first = 0; first < count; first += chunkSize) {
+
+            size_t length = std::min(chunkSize, count - first);
+
+            utility::kernels::unpack(pData + first * sizeof(CType), length, sizeof(CType), aValues);
+
+            if (_adUserValueTable.empty()) {
+
+                utility::kernels::toDouble(aValues, length, adUserValues + first);
+                adaptation.toUserValues(adUserValues + first, length, adUserValues + first);
+                continue;
+            }
+            for (size_t valueIndex = 0; valueIndex < length; valueIndex++) {
+
+                int64_t iValue = aValues[valueIndex];
+                size_t tableIndex = static_cast<size_t>(iValue - _min);
+
+                // Values out of range may have been written in raw format
+                adUserValues[first + valueIndex] = tableIndex < _adUserValueTable.size()
+                                                       ? _adUserValueTable[tableIndex]
+                                                       : adaptation.toUserValue(iValue);
+            }
+        }
+    }
+
+    /** Precomputes the user value of every integer of small adapted ranges
+     *
+     * Only done for arrays, whose reads then avoid calling the adaptation
+     * (typically a logarithm) for each value.
+     */
+    void buildUserValueTable()
+    {
+        const CParameterAdaptation *pParameterAdaption = getParameterAdaptation();
+        int64_t tableSize = int64_t{_max} - _min + 1;
+
+        if (!pParameterAdaption || getArrayLength() < 2 || tableSize > maxUserValueTableSize) {
+            return;
+        }
+        _adUserValueTable.resize(static_cast<size_t>(tableSize));
+
+        for (int64_t iValue = _min; iValue <= _max; iValue++) {
+            _adUserValueTable[static_cast<size_t>(iValue - _min)] =
+                pParameterAdaption->toUserValue(iValue);
+        }
+    }
+
 public:
     CIntegerParameterType(const std::string &name) : Base(name){};
 
@@ -103,7 +215,13 @@ public:
         }
 
         // Base
-        return Base::fromXml(xmlElement, serializingContext);
+        if (!Base::fromXml(xmlElement, serializingContext)) {
+
+            return false;
+        }
+        buildUserValueTable();
+
+        return true;
     }
 
     // From IXmlSource
@@ -122,16 +240,12 @@ public:
     bool fromBlackboard(std::string &strValue, const uint32_t &value,
                         CParameterAccessContext &parameterAccessContext) const override
     {
-        // Format
-        std::ostringstream stream;
-
         // Take care of format
         if (parameterAccessContext.valueSpaceIsRaw() &&
             parameterAccessContext.outputRawFormatIsHex()) {
 
             // Hexa display with unecessary bits cleared out
-            stream << "0x" << std::hex << std::uppercase
-                   << std::setw(static_cast<int>(getSize() * 2)) << std::setfill('0') << value;
+            strValue = utility::toHexadecimal(value, getSize() * 2);
         } else {
 
             if (isSigned) {
@@ -141,15 +255,13 @@ public:
                 // Sign extend
                 signExtend(iValue);
 
-                stream << iValue;
+                strValue = std::to_string(iValue);
             } else {
 
-                stream << value;
+                strValue = std::to_string(value);
             }
         }
 
-        strValue = stream.str();
-
         return true;
     }
 
@@ -266,6 +378,74 @@ public:
         return true;
     }
 
+    // Bulk conversions
+    bool bulkToBlackboard(const uint32_t *auiUserValues, size_t count, uint8_t *pData,
+                          CParameterAccessContext &parameterAccessContext) const override
+    {
+        return doBulkToBlackboard(auiUserValues, count, pData, parameterAccessContext);
+    }
+    bool bulkFromBlackboard(uint32_t *auiUserValues, size_t count, const uint8_t *pData,
+                            CParameterAccessContext & /*ctx*/) const override
+    {
+        doBulkFromBlackboard(auiUserValues, count, pData);
+        return true;
+    }
+    bool bulkToBlackboard(const int32_t *aiUserValues, size_t count, uint8_t *pData,
+                          CParameterAccessContext &parameterAccessContext) const override
+    {
+        return doBulkToBlackboard(aiUserValues, count, pData, parameterAccessContext);
+    }
+    bool bulkFromBlackboard(int32_t *aiUserValues, size_t count, const uint8_t *pData,
+                            CParameterAccessContext & /*ctx*/) const override
+    {
+        doBulkFromBlackboard(aiUserValues, count, pData);
+        return true;
+    }
+    bool bulkToBlackboard(const double *adUserValues, size_t count, uint8_t *pData,
+                          CParameterAccessContext &parameterAccessContext) const override
+    {
+        // Check if there's an adaptation object available
+        const CParameterAdaptation *pParameterAdaption = getParameterAdaptation();
+
+        if (!pParameterAdaption) {
+
+            // Reject request and let upper class handle the error
+            return Base::bulkToBlackboard(adUserValues, count, pData, parameterAccessContext);
+        }
+
+        // Check all values before writing any of them. Arrays fitting in one
+        // chunk are written as they are checked, larger ones are adapted twice.
+        bool bSingleChunk = count <= utility::kernels::chunkSize;
+
+        if (!adaptToBlackboard(*pParameterAdaption, adUserValues, count,
+                               bSingleChunk ? pData : nullptr)) {
+
+            parameterAccessContext.setError("Value out of range");
+
+            return false;
+        }
+        if (!bSingleChunk) {
+
+            adaptToBlackboard(*pParameterAdaption, adUserValues, count, pData);
+        }
+        return true;
+    }
+    bool bulkFromBlackboard(double *adUserValues, size_t count, const uint8_t *pData,
+                            CParameterAccessContext &parameterAccessContext) const override
+    {
+        // Check if there's an adaptation object available
+        const CParameterAdaptation *pParameterAdaption = getParameterAdaptation();
+
+        if (!pParameterAdaption) {
+
+            // Reject request and let upper class handle the error
+            return Base::bulkFromBlackboard(adUserValues, count, pData, parameterAccessContext);
+        }
+        adaptFromBlackboard(*pParameterAdaption, adUserValues, count, pData);
+
+        return true;
+    }
+
     // Default value handling (simulation only)
     uint32_t getDefaultValue() const override { return _min; }
 
@@ -339,7 +519,13 @@ public:
     }
 
 private:
+    /** Largest range whose user values are precomputed */
+    static const int64_t maxUserValueTableSize = 4096;
+
     // Range
     CType _min{std::numeric_limits<CType>::min()};
     CType _max{std::numeric_limits<CType>::max()};
+
+    /** User value of each integer of the range, for adapted arrays */
+    std::vector<double> _adUserValueTable;
 };
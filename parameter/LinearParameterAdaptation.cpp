@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "LinearParameterAdaptation.h"
+#include "ArrayKernels.hpp"
 
 #define base CParameterAdaptation
 
@@ -88,3 +89,17 @@ double CLinearParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return base::toUserValue(iValue) * _dSlopeDenominator / _dSlopeNumerator;
 }
+
+void CLinearParameterAdaptation::fromUserValues(const double *adUserValues, size_t count,
+                                                double *adValues) const
+{
+    utility::kernels::linearToInteger(adUserValues, count, _dSlopeNumerator, _dSlopeDenominator,
+                                      getOffset(), adValues);
+}
+
+void CLinearParameterAdaptation::toUserValues(const double *adValues, size_t count,
+                                              double *adUserValues) const
+{
+    utility::kernels::linearFromInteger(adValues, count, getOffset(), _dSlopeDenominator,
+                                        _dSlopeNumerator, adUserValues);
+}
@@ -83,3 +83,40 @@ double CLogarithmicParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return exp(base::toUserValue(iValue) * log(_dLogarithmBase));
 }
+
+void CLogarithmicParameterAdaptation::fromUserValues(const double *adUserValues, size_t count,
+                                                     double *adValues) const
+{
+    double dLogBase = log(_dLogarithmBase);
+
+    for (size_t valueIndex = 0; valueIndex < count; valueIndex++) {
+        adValues[valueIndex] = log(adUserValues[valueIndex]) / dLogBase;
+    }
+    base::fromUserValues(adValues, count, adValues);
+
+    if (_dFloorValue == -std::numeric_limits<double>::infinity()) {
+        return;
+    }
+    double dFloor = static_cast<double>(static_cast<int64_t>(_dFloorValue));
+
+    for (size_t valueIndex = 0; valueIndex < count; valueIndex++) {
+
+        // Written so that NaN (log of a negative value) is floored, as the
+        // integer conversion of fromUserValue does
+        if (!(adValues[valueIndex] >= dFloor)) {
+            adValues[valueIndex] = dFloor;
+        }
+    }
+}
+
+void CLogarithmicParameterAdaptation::toUserValues(const double *adValues, size_t count,
+                                                   double *adUserValues) const
+{
+    double dLogBase = log(_dLogarithmBase);
+
+    base::toUserValues(adValues, count, adUserValues);
+
+    for (size_t valueIndex = 0; valueIndex < count; valueIndex++) {
+        adUserValues[valueIndex] = exp(adUserValues[valueIndex] * dLogBase);
+    }
+}
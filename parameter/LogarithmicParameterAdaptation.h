@@ -55,6 +55,8 @@ public:
      */
     int64_t fromUserValue(double dValue) const override;
     double toUserValue(int64_t iValue) const override;
+    void fromUserValues(const double *adUserValues, size_t count, double *adValues) const override;
+    void toUserValues(const double *adValues, size_t count, double *adUserValues) const override;
 
     void showProperties(std::string &strResult) const override;
 
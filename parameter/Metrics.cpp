@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Metrics.h"
+#include "Utility.h"
+
+#include <algorithm>
+
+namespace core
+{
+namespace metrics
+{
+
+/** Registry activated in the calling thread */
+static thread_local Registry *currentRegistry = nullptr;
+
+/** @return the microseconds elapsed since start */
+static uint64_t microsecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+}
+
+/** @return the upper limit of a histogram bucket */
+static uint64_t bucketLimit(size_t bucket)
+{
+    return bucket == 0 ? 0 : (uint64_t{1} << bucket) - 1;
+}
+
+void Histogram::record(uint64_t value)
+{
+    size_t bucket = 0;
+    while (bucket < bucketCount - 1 && value > bucketLimit(bucket)) {
+        ++bucket;
+    }
+    mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = mMax.load(std::memory_order_relaxed);
+    while (value > max && !mMax.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+void Histogram::reset()
+{
+    for (auto &bucket : mBuckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    mCount.store(0, std::memory_order_relaxed);
+    mSum.store(0, std::memory_order_relaxed);
+    mMax.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getCount() const
+{
+    return mCount.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getMean() const
+{
+    uint64_t count = getCount();
+    return count == 0 ? 0 : mSum.load(std::memory_order_relaxed) / count;
+}
+
+uint64_t Histogram::getMax() const
+{
+    return mMax.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getQuantile(double quantile) const
+{
+    uint64_t counts[bucketCount];
+    uint64_t total = 0;
+    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+        counts[bucket] = mBuckets[bucket].load(std::memory_order_relaxed);
+        total += counts[bucket];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    // Rank of the quantile, starting from 1
+    auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * static_cast<double>(total)));
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            // The bucket limit is a bound, the max is tighter for the last values
+            return std::min(bucketLimit(bucket), getMax());
+        }
+    }
+    return getMax();
+}
+
+void Registry::count(Counter counter, uint64_t value)
+{
+    mCounters[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t Registry::get(Counter counter) const
+{
+    return mCounters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+void Registry::record(Latency latency, uint64_t duration)
+{
+    mLatencies[static_cast<size_t>(latency)].record(duration);
+}
+
+const Histogram &Registry::getHistogram(Latency latency) const
+{
+    return mLatencies[static_cast<size_t>(latency)];
+}
+
+void Registry::recordSync(const std::string &subsystem, bool bSuccess, uint64_t duration)
+{
+    record(Latency::sync, duration);
+
+    std::lock_guard<std::mutex> lock(mSyncsMutex);
+    Syncs &syncs = mSyncs[subsystem];
+    ++syncs.issued;
+    if (!bSuccess) {
+        ++syncs.failed;
+    }
+}
+
+void Registry::reset()
+{
+    for (auto &counter : mCounters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    for (auto &histogram : mLatencies) {
+        histogram.reset();
+    }
+    std::lock_guard<std::mutex> lock(mSyncsMutex);
+    mSyncs.clear();
+}
+
+/** Names of the counters, in the order of Registry::Counter */
+static const struct
+{
+    const char *text;
+    const char *json;
+} counterNames[Registry::counterCount] = {{"Applies", "applies"},
+                                          {"Domains evaluated", "domains_evaluated"},
+                                          {"Configurations switched", "configurations_switched"},
+                                          {"Bytes restored", "bytes_restored"}};
+
+/** Names of the latencies, in the order of Registry::Latency */
+static const char *const latencyNames[Registry::latencyCount] = {"apply", "sync", "get", "set"};
+
+void Registry::writeText(std::ostream &output) const
+{
+    for (size_t counter = 0; counter < counterCount; ++counter) {
+        output << counterNames[counter].text << ": " << mCounters[counter].load() << "\n";
+    }
+    output << "Latencies (us): count mean p50 p99 max\n";
+    for (size_t latency = 0; latency < latencyCount; ++latency) {
+        const Histogram &histogram = mLatencies[latency];
+        output << "    " << latencyNames[latency] << ": " << histogram.getCount() << " "
+               << histogram.getMean() << " " << histogram.getQuantile(0.5) << " "
+               << histogram.getQuantile(0.99) << " " << histogram.getMax() << "\n";
+    }
+    output << "Synchronizations per subsystem: issued failed\n";
+    std::lock_guard<std::mutex> lock(mSyncsMutex);
+    for (const auto &syncs : mSyncs) {
+        output << "    " << syncs.first << ": " << syncs.second.issued << " "
+               << syncs.second.failed << "\n";
+    }
+}
+
+void Registry::writeJson(std::ostream &output) const
+{
+    output << "{\"counters\":{";
+    for (size_t counter = 0; counter < counterCount; ++counter) {
+        output << (counter == 0 ? "" : ",") << "\"" << counterNames[counter].json
+               << "\":" << mCounters[counter].load();
+    }
+    output << "},\"latency_us\":{";
+    for (size_t latency = 0; latency < latencyCount; ++latency) {
+        const Histogram &histogram = mLatencies[latency];
+        output << (latency == 0 ? "" : ",") << "\"" << latencyNames[latency]
+               << "\":{\"count\":" << histogram.getCount() << ",\"mean\":" << histogram.getMean()
+               << ",\"p50\":" << histogram.getQuantile(0.5)
+               << ",\"p99\":" << histogram.getQuantile(0.99) << ",\"max\":" << histogram.getMax()
+               << "}";
+    }
+    output << "},\"syncs\":{";
+    std::lock_guard<std::mutex> lock(mSyncsMutex);
+    bool first = true;
+    for (const auto &syncs : mSyncs) {
+        output << (first ? "" : ",") << utility::asJsonString(syncs.first)
+               << ":{\"issued\":" << syncs.second.issued << ",\"failed\":" << syncs.second.failed
+               << "}";
+        first = false;
+    }
+    output << "}}\n";
+}
+
+Registry *Registry::current()
+{
+    return currentRegistry;
+}
+
+Registry::Scope::Scope(Registry &registry, Latency latency)
+    : mRegistry(registry), mPrevious(currentRegistry), mLatency(latency),
+      mStart(std::chrono::steady_clock::now())
+{
+    currentRegistry = &registry;
+}
+
+Registry::Scope::~Scope()
+{
+    mRegistry.record(mLatency, microsecondsSince(mStart));
+    currentRegistry = mPrevious;
+}
+
+Registry::Timer::Timer() : registry(currentRegistry)
+{
+    if (registry != nullptr) {
+        mStart = std::chrono::steady_clock::now();
+    }
+}
+
+uint64_t Registry::Timer::elapsed() const
+{
+    return microsecondsSince(mStart);
+}
+
+} // namespace metrics
+} // namespace core
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace core
+{
+namespace metrics
+{
+
+/** Lock free histogram of durations in microseconds, with power of 2 buckets */
+class Histogram : private utility::NonCopyable
+{
+public:
+    /** Bucket 0 counts null values, bucket i counts values in [2^(i-1), 2^i[ */
+    static const size_t bucketCount = 40;
+
+    /** @param[in] value the value to add */
+    void record(uint64_t value);
+
+    /** Forget all recorded values */
+    void reset();
+
+    uint64_t getCount() const;
+    uint64_t getMean() const;
+    uint64_t getMax() const;
+
+    /** @param[in] quantile between 0 and 1
+     * @return an upper bound of the quantile, the limit of the bucket containing it
+     */
+    uint64_t getQuantile(double quantile) const;
+
+private:
+    std::atomic<uint64_t> mBuckets[bucketCount] = {};
+    std::atomic<uint64_t> mCount{0};
+    std::atomic<uint64_t> mSum{0};
+    std::atomic<uint64_t> mMax{0};
+};
+
+/** Counters and latency histograms of a parameter framework instance
+ *
+ * Recording is lock free except for the per subsystem synchronization counters.
+ * Steps which do not know the registry record in the one activated in the calling
+ * thread, @see Scope.
+ */
+class Registry : private utility::NonCopyable
+{
+public:
+    enum class Counter
+    {
+        applies,
+        domainsEvaluated,
+        configurationsSwitched,
+        bytesRestored
+    };
+    static const size_t counterCount = 4;
+
+    enum class Latency
+    {
+        apply,
+        sync,
+        get,
+        set
+    };
+    static const size_t latencyCount = 4;
+
+    /**
+     * @param[in] counter the counter to increase
+     * @param[in] value the increment
+     */
+    void count(Counter counter, uint64_t value = 1);
+
+    /** @return the value of the counter */
+    uint64_t get(Counter counter) const;
+
+    /**
+     * @param[in] latency the histogram to record in
+     * @param[in] duration the duration in microseconds
+     */
+    void record(Latency latency, uint64_t duration);
+
+    /** @return the histogram of a latency */
+    const Histogram &getHistogram(Latency latency) const;
+
+    /** Record a synchronization of a subsystem
+     *
+     * @param[in] subsystem the name of the synchronized subsystem
+     * @param[in] bSuccess false if the synchronization failed
+     * @param[in] duration the duration in microseconds
+     */
+    void recordSync(const std::string &subsystem, bool bSuccess, uint64_t duration);
+
+    /** Forget all recorded values */
+    void reset();
+
+    /** Write the metrics in a human readable form
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeText(std::ostream &output) const;
+
+    /** Write the metrics as a JSON object
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeJson(std::ostream &output) const;
+
+    /** @return the registry activated in the calling thread, nullptr if none */
+    static Registry *current();
+
+    /** Activate a registry in the calling thread and time the scope */
+    class Scope : private utility::NonCopyable
+    {
+    public:
+        /**
+         * @param[in] registry the registry to activate
+         * @param[in] latency the histogram to record the scope duration in
+         */
+        Scope(Registry &registry, Latency latency);
+        ~Scope();
+
+    private:
+        Registry &mRegistry;
+        Registry *mPrevious;
+        Latency mLatency;
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+    /** Time a scope, does nothing if no registry is activated in the calling thread */
+    class Timer : private utility::NonCopyable
+    {
+    public:
+        Timer();
+
+        /** @return the elapsed time in microseconds */
+        uint64_t elapsed() const;
+
+        /** The registry activated at construction, nullptr if none */
+        Registry *const registry;
+
+    private:
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+private:
+    /** Synchronization counters of a subsystem */
+    struct Syncs
+    {
+        uint64_t issued;
+        uint64_t failed;
+    };
+
+    std::atomic<uint64_t> mCounters[counterCount] = {};
+    Histogram mLatencies[latencyCount];
+
+    /** Guards mSyncs */
+    mutable std::mutex mSyncsMutex;
+    std::map<std::string, Syncs> mSyncs;
+};
+
+} // namespace metrics
+} // namespace core
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ParameterAdaptation.h"
+#include "ArrayKernels.hpp"
 
 #define base CElement
 
@@ -82,3 +83,15 @@ double CParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return (double)(iValue - _iOffset);
 }
+
+void CParameterAdaptation::fromUserValues(const double *adUserValues, size_t count,
+                                          double *adValues) const
+{
+    utility::kernels::linearToInteger(adUserValues, count, 1, 1, _iOffset, adValues);
+}
+
+void CParameterAdaptation::toUserValues(const double *adValues, size_t count,
+                                        double *adUserValues) const
+{
+    utility::kernels::linearFromInteger(adValues, count, _iOffset, 1, 1, adUserValues);
+}
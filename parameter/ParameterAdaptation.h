@@ -49,6 +49,15 @@ public:
     virtual int64_t fromUserValue(double dValue) const;
     virtual double toUserValue(int64_t iValue) const;
 
+    /** Bulk conversions, used by array parameters
+     *
+     * Give the same results as fromUserValue/toUserValue called on each value.
+     * Integer values are carried as doubles, which represent them exactly.
+     * Input and output arrays may be the same.
+     */
+    virtual void fromUserValues(const double *adUserValues, size_t count, double *adValues) const;
+    virtual void toUserValues(const double *adValues, size_t count, double *adUserValues) const;
+
     // CElement
     std::string getKind() const override;
 
@@ -116,6 +116,18 @@ uint8_t *CParameterBlackboard::getLocation(size_t offset)
     return &mBlackboard[offset];
 }
 
+uint8_t *CParameterBlackboard::getLocation(size_t offset, size_t size)
+{
+    assertValidAccess(offset, size);
+    return mBlackboard.data() + offset;
+}
+
+const uint8_t *CParameterBlackboard::getLocation(size_t offset, size_t size) const
+{
+    assertValidAccess(offset, size);
+    return mBlackboard.data() + offset;
+}
+
 // Configuration handling
 void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset)
 {
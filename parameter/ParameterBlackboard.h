@@ -85,6 +85,18 @@ public:
     // Access from/to subsystems
     uint8_t *getLocation(size_t offset);
 
+    /** Direct access to a range of the blackboard memory.
+     *
+     * Used to read or write a whole array in one pass.
+     *
+     * @param[in] offset the range start in the blackboard.
+     * @param[in] size the range size, asserted to fit in the blackboard.
+     * @{
+     */
+    uint8_t *getLocation(size_t offset, size_t size);
+    const uint8_t *getLocation(size_t offset, size_t size) const;
+    /** @} */
+
     // Configuration handling
     void restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
     void saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
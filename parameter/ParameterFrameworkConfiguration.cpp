@@ -59,6 +59,18 @@ uint16_t CParameterFrameworkConfiguration::getServerPort() const
     return _uiServerPort;
 }
 
+// Server Unix domain socket path
+const std::string &CParameterFrameworkConfiguration::getServerSocketPath() const
+{
+    return _strServerSocketPath;
+}
+
+// Maximum number of remote clients
+uint32_t CParameterFrameworkConfiguration::getMaxRemoteClients() const
+{
+    return _uiMaxRemoteClients;
+}
+
 // From IXmlSink
 bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
                                                CXmlSerializingContext &serializingContext)
@@ -72,6 +84,12 @@ bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
     // Server port
     xmlElement.getAttribute("ServerPort", _uiServerPort);
 
+    // Server Unix domain socket path (optional)
+    xmlElement.getAttribute("ServerSocketPath", _strServerSocketPath);
+
+    // Maximum number of remote clients (optional)
+    xmlElement.getAttribute("MaxRemoteClients", _uiMaxRemoteClients);
+
     // Base
     return base::fromXml(xmlElement, serializingContext);
 }
@@ -42,9 +42,15 @@ public:
     // Tuning allowed
     bool isTuningAllowed() const;
 
-    // Server port
+    // Server port, 0 if the server does not listen on TCP
     uint16_t getServerPort() const;
 
+    // Server Unix domain socket path, empty if the server does not listen on one
+    const std::string &getServerSocketPath() const;
+
+    // Maximum number of clients connected at the same time to the server
+    uint32_t getMaxRemoteClients() const;
+
     // From IXmlSink
     bool fromXml(const CXmlElement &xmlElement,
                  CXmlSerializingContext &serializingContext) override;
@@ -59,4 +65,8 @@ private:
     bool _bTuningAllowed{false};
     // Server port
     uint16_t _uiServerPort{0};
+    // Server Unix domain socket path
+    std::string _strServerSocketPath;
+    // Maximum number of remote clients
+    uint32_t _uiMaxRemoteClients{4};
 };
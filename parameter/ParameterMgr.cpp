@@ -68,6 +68,7 @@
 #include "StringParameterType.h"
 #include "EnumParameterType.h"
 #include "BackgroundRemoteProcessorServer.h"
+#include "AnswerStream.h"
 #include "ElementLocator.h"
 #include "CompoundRule.h"
 #include "SelectionCriterionRule.h"
@@ -103,8 +104,12 @@
  * This macro aims to avoid this boring notation.
  * This macro should be called only once in a scope. Nested scopes can
  * call this macro too, as variable shadowing is supported.
+ * The title is only built if information logs are enabled.
  */
-#define LOG_CONTEXT(contextTitle) core::log::Context context(_logger, contextTitle)
+#define LOG_CONTEXT(contextTitle)                                                                  \
+    core::log::Context context(_logger, _logger.isEnabled(core::log::Level::info)                  \
+                                            ? std::string(contextTitle)                            \
+                                            : std::string())
 
 #ifdef SIMULATION
 // In simulation, back synchronization of the blackboard won't probably work
@@ -178,6 +183,28 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
     {"sync", &CParameterMgr::syncCommandProcess, 0, "",
      "Synchronize current settings to hardware while in Tuning Mode and Auto Sync off"},
 
+    /// Tracing
+    {"setTracing", &CParameterMgr::setTracingCommandProcess, 1, "on|off*",
+     "Turn on or off the tracing of configuration application"},
+    {"getTracing", &CParameterMgr::getTracingCommandProcess, 0, "", "Show tracing state"},
+    {"dumpTrace", &CParameterMgr::dumpTraceCommandProcess, 0, "",
+     "Show traced configuration application steps as Chrome trace event JSON"},
+    {"clearTrace", &CParameterMgr::clearTraceCommandProcess, 0, "",
+     "Forget traced configuration application steps"},
+
+    /// Metrics
+    {"getMetrics", &CParameterMgr::getMetricsCommandProcess, 0, "[text*|json]",
+     "Show counters and latencies of applications, synchronizations and parameter accesses"},
+    {"resetMetrics", &CParameterMgr::resetMetricsCommandProcess, 0, "", "Reset metrics"},
+    {"getStartupProfile", &CParameterMgr::getStartupProfileCommandProcess, 0, "",
+     "Show wall time, CPU time, allocated bytes and element counts of each start phase"},
+
+    /// Criterion recording
+    {"startCriterionRecording", &CParameterMgr::startCriterionRecordingCommandProcess, 1,
+     "<file path>", "Record criterion changes and configuration applications to a file"},
+    {"stopCriterionRecording", &CParameterMgr::stopCriterionRecordingCommandProcess, 0, "",
+     "Stop recording criterion changes"},
+
     /// Criteria
     {"listCriteria", &CParameterMgr::listCriteriaCommandProcess, 0, "[CSV|XML]",
      "List selection criteria"},
@@ -243,6 +270,13 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
      "Get settings of element at given path in Byte Array format"},
     {"setElementBytes", &CParameterMgr::setElementBytesCommandProcess, 2, "<elem path> <values>",
      "Set settings of element at given path in Byte Array format"},
+    {"getElementsRawBytes", &CParameterMgr::getElementsRawBytesCommandProcess, 1,
+     "<elem path list>",
+     "Get settings of elements at given paths as raw binary bytes, concatenated in order"},
+    {"setElementsRawBytes", &CParameterMgr::setElementsRawBytesCommandProcess, 2,
+     "<elem path list> <bytes>",
+     "Set settings of elements at given paths from raw binary bytes, concatenated in order"
+     " (sent as a binary argument)"},
     {"getElementXML", &CParameterMgr::getElementXMLCommandProcess, 1, "<elem path>",
      "Get settings of element at given path in XML format"},
     {"setElementXML", &CParameterMgr::setElementXMLCommandProcess, 2, "<elem path> <values>",
@@ -358,49 +392,77 @@ bool CParameterMgr::load(string &strError)
 {
     LOG_CONTEXT("Loading");
 
-    feedElementLibraries();
+    using Phase = core::profiling::StartupProfiler::Scope;
+    _startupProfiler.clear();
 
     // Load Framework configuration
-    if (!loadFrameworkConfiguration(strError)) {
+    {
+        Phase phase(_startupProfiler, "framework configuration");
 
-        return false;
+        feedElementLibraries();
+
+        if (!loadFrameworkConfiguration(strError)) {
+
+            return false;
+        }
     }
 
-    if (!loadSubsystems(strError)) {
+    {
+        Phase phase(_startupProfiler, "subsystem plugins");
 
-        return false;
+        if (!loadSubsystems(strError)) {
+
+            return false;
+        }
     }
 
     // Load structure
-    if (!loadStructure(strError)) {
+    {
+        Phase phase(_startupProfiler, "structure");
 
-        return false;
+        if (!loadStructure(strError)) {
+
+            return false;
+        }
     }
 
     // Load settings
-    if (!loadSettings(strError)) {
+    {
+        Phase phase(_startupProfiler, "settings");
 
-        return false;
+        if (!loadSettings(strError)) {
+
+            return false;
+        }
     }
 
     // Init flow of element tree
-    if (!init(strError)) {
+    {
+        Phase phase(_startupProfiler, "init");
 
-        return false;
+        if (!init(strError)) {
+
+            return false;
+        }
     }
 
     {
+        Phase phase(_startupProfiler, "back synchronization");
         LOG_CONTEXT("Main blackboard back synchronization");
 
         // Back synchronization for areas in parameter blackboard not covered by any domain
         BackSynchronizer(getConstSystemClass(), _pMainParameterBlackboard).sync();
     }
 
-    // We're done loading the settings and back synchronizing
-    CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
+    {
+        Phase phase(_startupProfiler, "validation");
 
-    // We need to ensure all domains are valid
-    pConfigurableDomains->validate(_pMainParameterBlackboard);
+        // We're done loading the settings and back synchronizing
+        CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
+
+        // We need to ensure all domains are valid
+        pConfigurableDomains->validate(_pMainParameterBlackboard);
+    }
 
     // Log selection criterion states
     {
@@ -414,16 +476,47 @@ bool CParameterMgr::load(string &strError)
         info() << criteria;
     }
 
-    // Subsystem can not ask for resync as they have not been synced yet
-    getSystemClass()->cleanSubsystemsNeedToResync();
+    {
+        Phase phase(_startupProfiler, "initial application");
 
-    // At initialization, check subsystems that need resync
-    doApplyConfigurations(true);
+        // Subsystem can not ask for resync as they have not been synced yet
+        getSystemClass()->cleanSubsystemsNeedToResync();
+
+        // At initialization, check subsystems that need resync
+        doApplyConfigurations(true);
+    }
 
     // Start remote processor server if appropriate
+    Phase phase(_startupProfiler, "remote interface");
     return handleRemoteProcessingInterface(strError);
 }
 
+/** @return the number of elements in the tree rooted at the given element, itself included */
+static size_t countTreeElements(const CElement *pElement)
+{
+    size_t count = 1;
+
+    for (size_t child = 0; child < pElement->getNbChildren(); child++) {
+
+        count += countTreeElements(pElement->getChild(child));
+    }
+    return count;
+}
+
+void CParameterMgr::countElements(size_t &elements, size_t &configurations) const
+{
+    elements = countTreeElements(getConstSystemClass());
+
+    // Domain configurations are the children of the domains
+    const CConfigurableDomains *pConfigurableDomains = getConstConfigurableDomains();
+    configurations = 0;
+
+    for (size_t domain = 0; domain < pConfigurableDomains->getNbChildren(); domain++) {
+
+        configurations += pConfigurableDomains->getChild(domain)->getNbChildren();
+    }
+}
+
 bool CParameterMgr::loadFrameworkConfiguration(string &strError)
 {
     LOG_CONTEXT("Loading framework configuration");
@@ -665,8 +758,23 @@ CSelectionCriterion *CParameterMgr::createSelectionCriterion(
     const string &strName, const CSelectionCriterionType *pSelectionCriterionType)
 {
     // Propagate
-    return getSelectionCriteria()->createSelectionCriterion(strName, pSelectionCriterionType,
-                                                            _logger);
+    CSelectionCriterion *pSelectionCriterion = getSelectionCriteria()->createSelectionCriterion(
+        strName, pSelectionCriterionType, _logger);
+
+    pSelectionCriterion->setChangeObserver([this](const CSelectionCriterion &criterion) {
+        if (_pRemoteProcessorServer != nullptr && _pRemoteProcessorServer->hasSubscribers()) {
+            notifyRemoteClients("criterion", criterion.getFormattedDescription(false, true));
+        }
+        if (_bRecordingCriteria) {
+
+            lock_guard<mutex> recorderLock(_criterionRecorderMutex);
+            auto recorded = _recordedCriteria.find(&criterion);
+            if (_criterionRecorder.isOpen() && recorded != _recordedCriteria.end()) {
+                _criterionRecorder.change(recorded->second, criterion.getCriterionState());
+            }
+        }
+    });
+    return pSelectionCriterion;
 }
 
 // Selection criterion retrieval
@@ -681,6 +789,14 @@ void CParameterMgr::applyConfigurations()
 {
     LOG_CONTEXT("Configuration application request");
 
+    if (_bRecordingCriteria) {
+
+        lock_guard<mutex> recorderLock(_criterionRecorderMutex);
+        if (_criterionRecorder.isOpen()) {
+            _criterionRecorder.apply();
+        }
+    }
+
     // Lock state
     lock_guard<mutex> autoLock(getBlackboardMutex());
 
@@ -1054,6 +1170,111 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::syncCommandProcess(
     return sync(strResult) ? CCommandHandler::EDone : CCommandHandler::EFailed;
 }
 
+/// Tracing
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setTracingCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    if (remoteCommand.getArgument(0) == "on") {
+
+        if (setTracing(true, strResult)) {
+
+            return CCommandHandler::EDone;
+        }
+    } else if (remoteCommand.getArgument(0) == "off") {
+
+        if (setTracing(false, strResult)) {
+
+            return CCommandHandler::EDone;
+        }
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    return CCommandHandler::EFailed;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getTracingCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = isTracingOn() ? "on" : "off";
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::dumpTraceCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    CAnswerStream answer(remoteCommand);
+    writeChromeTrace(answer);
+    strResult = answer.str();
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::clearTraceCommandProcess(
+    const IRemoteCommand & /*command*/, string & /*strResult*/)
+{
+    _tracer.clear();
+
+    return CCommandHandler::EDone;
+}
+
+/// Metrics
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getMetricsCommandProcess(
+    const IRemoteCommand &remoteCommand, string &strResult)
+{
+    ostringstream output;
+
+    if (remoteCommand.getArgumentCount() == 0 || remoteCommand.getArgument(0) == "text") {
+
+        _metrics.writeText(output);
+    } else if (remoteCommand.getArgument(0) == "json") {
+
+        _metrics.writeJson(output);
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    strResult = output.str();
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::resetMetricsCommandProcess(
+    const IRemoteCommand & /*command*/, string & /*strResult*/)
+{
+    _metrics.reset();
+
+    return CCommandHandler::EDone;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getStartupProfileCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    ostringstream output;
+    _startupProfiler.write(output);
+    strResult = output.str();
+
+    return CCommandHandler::ESucceeded;
+}
+
+/// Criterion recording
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
+    startCriterionRecordingCommandProcess(const IRemoteCommand &remoteCommand, string &strResult)
+{
+    return startCriterionRecording(remoteCommand.getArgument(0), strResult)
+               ? CCommandHandler::EDone
+               : CCommandHandler::EFailed;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::stopCriterionRecordingCommandProcess(
+    const IRemoteCommand & /*command*/, string & /*strResult*/)
+{
+    stopCriterionRecording();
+
+    return CCommandHandler::EDone;
+}
+
 /// Criteria
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listCriteriaCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
@@ -1231,14 +1452,16 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listConfigurationsC
 }
 
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::dumpDomainsCommandProcess(
-    const IRemoteCommand & /*command*/, string &strResult)
+    const IRemoteCommand &remoteCommand, string &strResult)
 {
     // Dummy error context
     string strError;
     utility::ErrorContext errorContext(strError);
 
     // Dump
-    strResult = getConstConfigurableDomains()->dumpContent(errorContext);
+    CAnswerStream answer(remoteCommand);
+    getConstConfigurableDomains()->dumpContent(answer, errorContext);
+    strResult = answer.str();
 
     return CCommandHandler::ESucceeded;
 }
@@ -1371,7 +1594,9 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listElementsCommand
     }
 
     // Return sub-elements
-    strResult += pLocatedElement->listQualifiedPaths(false);
+    CAnswerStream answer(remoteCommand);
+    pLocatedElement->listQualifiedPaths(answer, false);
+    strResult += answer.str();
 
     return CCommandHandler::ESucceeded;
 }
@@ -1398,7 +1623,9 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listParametersComma
     }
 
     // Return sub-elements
-    strResult += pLocatedElement->listQualifiedPaths(true);
+    CAnswerStream answer(remoteCommand);
+    pLocatedElement->listQualifiedPaths(answer, true);
+    strResult += answer.str();
 
     return CCommandHandler::ESucceeded;
 }
@@ -1520,6 +1747,115 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setElementBytesComm
     return CCommandHandler::EDone;
 }
 
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementsRawBytesCommandProcess(
+    const IRemoteCommand &remoteCommand, std::string &strResult)
+{
+    CElementLocator elementLocator(getSystemClass());
+
+    // All elements are read from the same blackboard state
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    string strBytes;
+
+    for (const auto &strPath : remoteCommand.getArguments()) {
+
+        CElement *pLocatedElement = nullptr;
+
+        if (!elementLocator.locate(strPath, &pLocatedElement, strResult)) {
+
+            return CCommandHandler::EFailed;
+        }
+
+        const CConfigurableElement *pConfigurableElement =
+            static_cast<CConfigurableElement *>(pLocatedElement);
+
+        // Read the settings right after the previous ones, without formatting
+        size_t offset = strBytes.size();
+        size_t size = pConfigurableElement->getFootPrint();
+
+        strBytes.resize(offset + size);
+        _pMainParameterBlackboard->readBuffer(&strBytes[offset], size,
+                                              pConfigurableElement->getOffset());
+    }
+
+    strResult = std::move(strBytes);
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setElementsRawBytesCommandProcess(
+    const IRemoteCommand &remoteCommand, std::string &strResult)
+{
+    // Check tuning mode
+    if (!checkTuningModeOn(strResult)) {
+
+        return CCommandHandler::EFailed;
+    }
+
+    CElementLocator elementLocator(getSystemClass());
+
+    // Locate all elements before writing any
+    size_t elementCount = remoteCommand.getArgumentCount() - 1;
+    const string &strBytes = remoteCommand.getArgument(elementCount);
+    vector<const CConfigurableElement *> elements;
+    size_t size = 0;
+
+    elements.reserve(elementCount);
+
+    for (size_t element = 0; element < elementCount; element++) {
+
+        CElement *pLocatedElement = nullptr;
+
+        if (!elementLocator.locate(remoteCommand.getArgument(element), &pLocatedElement,
+                                   strResult)) {
+
+            return CCommandHandler::EFailed;
+        }
+
+        elements.push_back(static_cast<CConfigurableElement *>(pLocatedElement));
+        size += elements.back()->getFootPrint();
+    }
+
+    // Check sizes match
+    if (size != strBytes.size()) {
+
+        strResult = "Wrong size: Expected: " + std::to_string(size) + " Provided: " +
+                    std::to_string(strBytes.size());
+
+        return CCommandHandler::EFailed;
+    }
+
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    // Write bytes, then synchronize all elements at once
+    CSyncerSet syncerSet;
+    size_t offset = 0;
+
+    for (const auto *pConfigurableElement : elements) {
+
+        size_t elementSize = pConfigurableElement->getFootPrint();
+
+        _pMainParameterBlackboard->writeBuffer(&strBytes[offset], elementSize,
+                                               pConfigurableElement->getOffset());
+        offset += elementSize;
+
+        pConfigurableElement->fillSyncerSet(syncerSet);
+    }
+
+    if (autoSyncOn()) {
+
+        core::Results errors;
+        if (!syncerSet.sync(*_pMainParameterBlackboard, false, &errors)) {
+
+            strResult = utility::asString(errors);
+
+            return CCommandHandler::EFailed;
+        }
+    }
+
+    return CCommandHandler::EDone;
+}
+
 bool CParameterMgr::getSettingsAsXML(const CConfigurableElement *configurableElement,
                                      string &result) const
 {
@@ -1635,7 +1971,9 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::dumpElementCommandP
                                                    _bValueSpaceIsRaw, _bOutputRawFormatIsHex);
 
     // Dump elements
-    strResult = pLocatedElement->dumpContent(parameterAccessContext);
+    CAnswerStream answer(remoteCommand);
+    pLocatedElement->dumpContent(answer, parameterAccessContext);
+    strResult = answer.str();
 
     return CCommandHandler::ESucceeded;
 }
@@ -1889,12 +2227,20 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
 }
 
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
-    getDomainsWithSettingsXMLCommandProcess(const IRemoteCommand & /*command*/, string &strResult)
+    getDomainsWithSettingsXMLCommandProcess(const IRemoteCommand &remoteCommand, string &strResult)
 {
-    if (!exportDomainsXml(strResult, true, false, strResult)) {
+    LOG_CONTEXT("Exporting domains to a remote client");
+
+    CXmlDomainExportContext exportContext(strResult, true, _bValueSpaceIsRaw,
+                                          _bOutputRawFormatIsHex);
+    CAnswerStream answer(remoteCommand);
+
+    if (!serializeElement(answer, exportContext, *getConstConfigurableDomains())) {
 
         return CCommandHandler::EFailed;
     }
+    strResult = answer.str();
+
     // Succeeded
     return CCommandHandler::ESucceeded;
 }
@@ -1904,9 +2250,27 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getDomainWithSettin
 {
     string strDomainName = remoteCommand.getArgument(0);
 
-    return exportSingleDomainXml(strResult, strDomainName, true, false, strResult)
-               ? CCommandHandler::ESucceeded
-               : CCommandHandler::EFailed;
+    LOG_CONTEXT("Exporting single domain '" + strDomainName + "' to a remote client");
+
+    const CConfigurableDomain *requestedDomain =
+        getConstConfigurableDomains()->findConfigurableDomain(strDomainName, strResult);
+
+    if (requestedDomain == nullptr) {
+
+        return CCommandHandler::EFailed;
+    }
+
+    CXmlDomainExportContext exportContext(strResult, true, _bValueSpaceIsRaw,
+                                          _bOutputRawFormatIsHex);
+    CAnswerStream answer(remoteCommand);
+
+    if (!serializeElement(answer, exportContext, *requestedDomain)) {
+
+        return CCommandHandler::EFailed;
+    }
+    strResult = answer.str();
+
+    return CCommandHandler::ESucceeded;
 }
 
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
@@ -1939,18 +2303,22 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setDomainWithSettin
 }
 
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getSystemClassXMLCommandProcess(
-    const IRemoteCommand & /*command*/, string &strResult)
+    const IRemoteCommand &remoteCommand, string &strResult)
 {
     // Get Root element where to export from
     const CSystemClass *pSystemClass = getSystemClass();
 
     // Use default access context for structure export
     CParameterAccessContext accessContext(strResult);
-    if (!exportElementToXMLString(pSystemClass, pSystemClass->getXmlElementName(),
+    CAnswerStream answer(remoteCommand);
+
+    if (!exportElementToXMLStream(pSystemClass, pSystemClass->getXmlElementName(),
                                   CXmlParameterSerializingContext{accessContext, strResult},
-                                  strResult)) {
+                                  answer)) {
         return CCommandHandler::EFailed;
     }
+    strResult = answer.str();
+
     // Succeeded
     return CCommandHandler::ESucceeded;
 }
@@ -2090,6 +2458,9 @@ bool CParameterMgr::accessValue(CParameterAccessContext &parameterAccessContext,
                                 const string &strPath, string &strValue, bool bSet,
                                 string &strError)
 {
+    using Latency = core::metrics::Registry::Latency;
+    core::metrics::Registry::Scope metricsScope(_metrics, bSet ? Latency::set : Latency::get);
+
     // Lock state
     lock_guard<mutex> autoLock(getBlackboardMutex());
 
@@ -2811,6 +3182,108 @@ void CParameterMgr::feedElementLibraries()
     _pElementLibrarySet->addElementLibrary(pParameterConfigurationLibrary);
 }
 
+void CParameterMgr::setLogLevel(core::log::Level level)
+{
+    _logger.setLevel(level);
+}
+
+core::log::Level CParameterMgr::getLogLevel() const
+{
+    return _logger.getLevel();
+}
+
+bool CParameterMgr::setTracing(bool bEnabled, string &strError)
+{
+    if (!_tracer.setEnabled(bEnabled)) {
+
+        strError = "Tracing support is not built in";
+        return false;
+    }
+    return true;
+}
+
+bool CParameterMgr::isTracingOn() const
+{
+    return _tracer.isEnabled();
+}
+
+void CParameterMgr::setTraceHook(core::trace::Tracer::Hook hook)
+{
+    _tracer.setHook(hook);
+}
+
+void CParameterMgr::writeChromeTrace(std::ostream &output) const
+{
+    _tracer.writeChromeTrace(output);
+}
+
+core::metrics::Registry &CParameterMgr::getMetrics()
+{
+    return _metrics;
+}
+
+const core::profiling::StartupProfiler &CParameterMgr::getStartupProfiler() const
+{
+    return _startupProfiler;
+}
+
+bool CParameterMgr::startCriterionRecording(const string &path, string &strError)
+{
+    lock_guard<mutex> recorderLock(_criterionRecorderMutex);
+
+    if (!_criterionRecorder.open(path, strError)) {
+
+        _bRecordingCriteria = false;
+        return false;
+    }
+
+    // Define the criteria in the recording
+    const CSelectionCriteriaDefinition *pDefinition =
+        getConstSelectionCriteria()->getSelectionCriteriaDefinition();
+    _recordedCriteria.clear();
+
+    for (size_t index = 0; index < pDefinition->getNbChildren(); index++) {
+
+        auto criterion = static_cast<const CSelectionCriterion *>(pDefinition->getChild(index));
+        auto type = static_cast<const CSelectionCriterionType *>(criterion->getCriterionType());
+        utility::criterionTrace::Definition definition{criterion->getName(),
+                                                       type->isTypeInclusive(),
+                                                       {},
+                                                       criterion->getCriterionState()};
+
+        for (auto &valuePair : type->getValuePairs()) {
+
+            // The "none" value of inclusive types is implicit
+            if (!definition.bInclusive || valuePair.second != 0) {
+                definition.valuePairs.emplace_back(valuePair.second, valuePair.first);
+            }
+        }
+        _criterionRecorder.define(definition);
+        _recordedCriteria[criterion] = index;
+    }
+    _bRecordingCriteria = true;
+
+    info() << "Recording criteria to " << path;
+    return true;
+}
+
+void CParameterMgr::stopCriterionRecording()
+{
+    lock_guard<mutex> recorderLock(_criterionRecorderMutex);
+
+    _bRecordingCriteria = false;
+    _criterionRecorder.close();
+}
+
+vector<string> CParameterMgr::getAppliedConfigurations()
+{
+    lock_guard<mutex> autoLock(getBlackboardMutex());
+
+    vector<string> appliedConfigurations;
+    getConstConfigurableDomains()->listLastAppliedConfigurations(appliedConfigurations);
+    return appliedConfigurations;
+}
+
 bool CParameterMgr::getForceNoRemoteInterface() const
 {
     return _bForceNoRemoteInterface;
@@ -2843,6 +3316,14 @@ bool CParameterMgr::isRemoteInterfaceRequired()
     return (not _bForceNoRemoteInterface) and getConstFrameworkConfiguration()->isTuningAllowed();
 }
 
+void CParameterMgr::notifyRemoteClients(const string &strKind, const string &strEvent)
+{
+    if (_pRemoteProcessorServer != nullptr && _pRemoteProcessorServer->hasSubscribers()) {
+
+        _pRemoteProcessorServer->notify(strKind, strEvent);
+    }
+}
+
 // Remote Processor Server connection handling
 bool CParameterMgr::handleRemoteProcessingInterface(string &strError)
 {
@@ -2853,10 +3334,22 @@ bool CParameterMgr::handleRemoteProcessingInterface(string &strError)
     }
 
     auto port = getConstFrameworkConfiguration()->getServerPort();
+    const auto &socketPath = getConstFrameworkConfiguration()->getServerSocketPath();
+    auto maxClients = getConstFrameworkConfiguration()->getMaxRemoteClients();
+
+    // Describe where the server listens, for logs
+    string strListeners;
+    if (port != 0) {
+        strListeners = "port " + std::to_string(port);
+    }
+    if (!socketPath.empty()) {
+        strListeners += (strListeners.empty() ? "socket " : " and socket ") + socketPath;
+    }
 
     try {
         // The ownership of remoteComandHandler is given to Bg remote processor server.
-        _pRemoteProcessorServer = new BackgroundRemoteProcessorServer(port, createCommandHandler());
+        _pRemoteProcessorServer = new BackgroundRemoteProcessorServer(
+            port, socketPath, createCommandHandler(), maxClients);
     } catch (std::runtime_error &e) {
         strError = string("ParameterMgr: Unable to create Remote Processor Server: ") + e.what();
         return false;
@@ -2868,12 +3361,11 @@ bool CParameterMgr::handleRemoteProcessingInterface(string &strError)
     }
 
     if (!_pRemoteProcessorServer->start(strError)) {
-        ostringstream oss;
-        oss << "ParameterMgr: Unable to start remote processor server on port " << port;
-        strError = oss.str() + ": " + strError;
+        strError = "ParameterMgr: Unable to start remote processor server" +
+                   (strListeners.empty() ? "" : " on " + strListeners) + ": " + strError;
         return false;
     }
-    info() << "Remote Processor Server started on port " << port;
+    info() << "Remote Processor Server started on " << strListeners;
     return true;
 }
 
@@ -2928,6 +3420,10 @@ const CConfigurableDomains *CParameterMgr::getConstConfigurableDomains() const
 void CParameterMgr::doApplyConfigurations(bool bForce)
 {
     LOG_CONTEXT("Applying configurations");
+    PFW_TRACE_ACTIVATE(_tracer);
+    PFW_TRACE_SPAN("applyConfigurations", bForce ? "forced" : "");
+    core::metrics::Registry::Scope metricsScope(_metrics, core::metrics::Registry::Latency::apply);
+    _metrics.count(core::metrics::Registry::Counter::applies);
 
     CSyncerSet syncerSet;
 
@@ -2936,8 +3432,24 @@ void CParameterMgr::doApplyConfigurations(bool bForce)
     getSystemClass()->checkForSubsystemsToResync(syncerSet, infos);
 
     // Ensure application of currently selected configurations
-    getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce, infos);
+    // Applied configurations are only described if someone is to be told about them
+    bool bDescribeApplied =
+        _logger.isEnabled(core::log::Level::info) ||
+        (_pRemoteProcessorServer != nullptr && _pRemoteProcessorServer->hasSubscribers());
+    core::Results applied;
+    core::Results syncErrors;
+    getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce,
+                                    bDescribeApplied ? &applied : nullptr, &syncErrors);
+    infos.insert(end(infos), begin(applied), end(applied));
     info() << infos;
+    warning() << syncErrors;
+
+    for (const auto &configuration : applied) {
+        notifyRemoteClients("configuration", configuration);
+    }
+    for (const auto &error : syncErrors) {
+        notifyRemoteClients("sync", error);
+    }
 
     // Reset the modified status of the current criteria to indicate that a new configuration has
     // been applied
@@ -2950,21 +3462,32 @@ bool CParameterMgr::exportElementToXMLString(const IXmlSource *pXmlSource,
                                              CXmlSerializingContext &&xmlSerializingContext,
                                              string &strResult) const
 {
-    // Use a doc source by loading data from instantiated Configurable Domains
-    CXmlMemoryDocSource memorySource(pXmlSource, false, strRootElementType);
-
     // Use a doc sink that write the doc data in a string
     ostringstream output;
-    CXmlStreamDocSink streamSink(output);
 
-    // Do the export
-    bool bProcessSuccess = streamSink.process(memorySource, xmlSerializingContext);
+    bool bProcessSuccess = exportElementToXMLStream(pXmlSource, strRootElementType,
+                                                    std::move(xmlSerializingContext), output);
 
     strResult = output.str();
 
     return bProcessSuccess;
 }
 
+bool CParameterMgr::exportElementToXMLStream(const IXmlSource *pXmlSource,
+                                             const string &strRootElementType,
+                                             CXmlSerializingContext &&xmlSerializingContext,
+                                             std::ostream &output) const
+{
+    // Use a doc source by loading data from instantiated Configurable Domains
+    CXmlMemoryDocSource memorySource(pXmlSource, false, strRootElementType);
+
+    // Use a doc sink that write the doc data in a stream
+    CXmlStreamDocSink streamSink(output);
+
+    // Do the export
+    return streamSink.process(memorySource, xmlSerializingContext);
+}
+
 bool CParameterMgr::logResult(bool isSuccess, const std::string &result)
 {
     std::string log = result.empty() ? "" : ": " + result;
@@ -29,6 +29,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <map>
 #include <vector>
@@ -41,6 +42,10 @@
 #include "XmlDocSource.h"
 #include "XmlDomainExportContext.h"
 #include "Results.h"
+#include "Tracer.h"
+#include "Metrics.h"
+#include "StartupProfiler.h"
+#include "CriterionTrace.h"
 #include "ElementHandle.h"
 #include <log/LogWrapper.h>
 #include <log/Context.h>
@@ -144,6 +149,62 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error);
 
+    /** Set the minimum level of the logs to emit
+     *
+     * Logs below this level are discarded before being formatted.
+     *
+     * @param[in] level the minimum level to emit
+     */
+    void setLogLevel(core::log::Level level);
+
+    /** @return the minimum level of the emitted logs */
+    core::log::Level getLogLevel() const;
+
+    /** Enable or disable the tracing of configuration application
+     *
+     * @param[in] bEnabled true to record the steps of configuration application
+     * @param[out] strError human readable error if tracing support is not built
+     * @return false if unable to set, true otherwise.
+     */
+    bool setTracing(bool bEnabled, std::string &strError);
+
+    /** @return true if configuration application is traced */
+    bool isTracingOn() const;
+
+    /** @param[in] hook called on each traced step, may be empty */
+    void setTraceHook(core::trace::Tracer::Hook hook);
+
+    /** Write the traced steps as Chrome trace event JSON
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeChromeTrace(std::ostream &output) const;
+
+    /** @return the counters and latency histograms of this instance */
+    core::metrics::Registry &getMetrics();
+
+    /** @return the profile of the phases of the last start */
+    const core::profiling::StartupProfiler &getStartupProfiler() const;
+
+    /** Record the criterion changes and the configuration application requests to a file
+     *
+     * The file starts with the definition and the state of each criterion.
+     * @see utility::criterionTrace for the file format.
+     *
+     * @param[in] path the file to record to, overwritten if it exists
+     * @param[out] strError the error if the file can not be created
+     * @return true on success, false otherwise
+     */
+    bool startCriterionRecording(const std::string &path, std::string &strError);
+
+    /** Stop recording criterion changes, no-op if not recording */
+    void stopCriterionRecording();
+
+    /** @return the last applied configuration of each domain, as "<domain>/<configuration>",
+     *          in domain order, the domains which did not apply any being skipped
+     */
+    std::vector<std::string> getAppliedConfigurations();
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -387,6 +448,15 @@ public:
                                   CXmlSerializingContext &&xmlSerializingContext,
                                   std::string &strResult) const;
 
+    /** Same as exportElementToXMLString, but writes the xml description to a stream
+     *
+     * @param[out] output the stream to write the xml description to
+     */
+    bool exportElementToXMLStream(const IXmlSource *pXmlSource,
+                                  const std::string &strRootElementType,
+                                  CXmlSerializingContext &&xmlSerializingContext,
+                                  std::ostream &output) const;
+
     // CElement
     std::string getKind() const override;
 
@@ -447,6 +517,27 @@ private:
                                                              std::string &strResult);
     CCommandHandler::CommandStatus syncCommandProcess(const IRemoteCommand &remoteCommand,
                                                       std::string &strResult);
+    /// Tracing
+    CCommandHandler::CommandStatus setTracingCommandProcess(const IRemoteCommand &remoteCommand,
+                                                            std::string &strResult);
+    CCommandHandler::CommandStatus getTracingCommandProcess(const IRemoteCommand &remoteCommand,
+                                                            std::string &strResult);
+    CCommandHandler::CommandStatus dumpTraceCommandProcess(const IRemoteCommand &remoteCommand,
+                                                           std::string &strResult);
+    CCommandHandler::CommandStatus clearTraceCommandProcess(const IRemoteCommand &remoteCommand,
+                                                            std::string &strResult);
+    /// Metrics
+    CCommandHandler::CommandStatus getMetricsCommandProcess(const IRemoteCommand &remoteCommand,
+                                                            std::string &strResult);
+    CCommandHandler::CommandStatus resetMetricsCommandProcess(const IRemoteCommand &remoteCommand,
+                                                              std::string &strResult);
+    CCommandHandler::CommandStatus getStartupProfileCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /// Criterion recording
+    CCommandHandler::CommandStatus startCriterionRecordingCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus stopCriterionRecordingCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     /// Criteria
     CCommandHandler::CommandStatus listCriteriaCommandProcess(const IRemoteCommand &remoteCommand,
                                                               std::string &strResult);
@@ -509,6 +600,12 @@ private:
         const IRemoteCommand &remoteCommand, std::string &strResult);
     CCommandHandler::CommandStatus setElementBytesCommandProcess(
         const IRemoteCommand &remoteCommand, std::string &strResult);
+    /** Get the settings of several elements as raw bytes, concatenated in argument order */
+    CCommandHandler::CommandStatus getElementsRawBytesCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /** Set the settings of several elements from raw bytes, given as last binary argument */
+    CCommandHandler::CommandStatus setElementsRawBytesCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     CCommandHandler::CommandStatus getElementXMLCommandProcess(const IRemoteCommand &remoteCommand,
                                                                std::string &strResult);
     CCommandHandler::CommandStatus setElementXMLCommandProcess(const IRemoteCommand &remoteCommand,
@@ -819,6 +916,13 @@ private:
     const CConfigurableDomains *getConstConfigurableDomains();
     const CConfigurableDomains *getConstConfigurableDomains() const;
 
+    /** Count the elements of the system class and the configurations of the domains
+     *
+     * @param[out] elements the number of elements in the system class tree
+     * @param[out] configurations the number of configurations of all domains
+     */
+    void countElements(size_t &elements, size_t &configurations) const;
+
     // Apply configurations
     void doApplyConfigurations(bool bForce);
 
@@ -827,6 +931,13 @@ private:
 
     // Remote Processor Server connection handling
     bool isRemoteInterfaceRequired();
+
+    /** Push an event to the remote clients subscribed to notifications, if any
+     *
+     * @param[in] strKind the kind of event, clients may filter on it
+     * @param[in] strEvent the human readable event
+     */
+    void notifyRemoteClients(const std::string &strKind, const std::string &strEvent);
     bool handleRemoteProcessingInterface(std::string &strError);
 
     /** Log the result of a function
@@ -883,6 +994,30 @@ private:
     /** Application main logger based on the one provided by the client */
     mutable core::log::Logger _logger;
 
+    /** Maximum number of traced steps kept in memory */
+    static const size_t traceCapacity = 16384;
+
+    /** Records the steps of configuration application */
+    core::trace::Tracer _tracer{traceCapacity};
+
+    /** Counters and latency histograms */
+    core::metrics::Registry _metrics;
+
+    /** Profile of the phases of the start */
+    core::profiling::StartupProfiler _startupProfiler{
+        [this](size_t &elements, size_t &configurations) {
+            countElements(elements, configurations);
+        }};
+
+    /** Records the criterion changes and the application requests, if open */
+    utility::criterionTrace::Writer _criterionRecorder;
+    /** Indexes of the criteria in the recording */
+    std::map<const CSelectionCriterion *, size_t> _recordedCriteria;
+    /** Protects the recorder as criteria may change concurrently with applications */
+    std::mutex _criterionRecorderMutex;
+    /** Checked before locking so that not recording is free */
+    std::atomic<bool> _bRecordingCriteria{false};
+
     /** If set to false, the remote interface won't be started no matter what.
      * If set to true - the default - it has no impact on the policy for
      * starting the remote interface.
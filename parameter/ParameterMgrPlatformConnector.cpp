@@ -30,6 +30,7 @@
 #include "ParameterMgrPlatformConnector.h"
 #include "ParameterMgr.h"
 #include "ParameterMgrLogger.h"
+#include "AsyncLogger.h"
 #include <assert.h>
 
 using std::string;
@@ -39,13 +40,17 @@ CParameterMgrPlatformConnector::CParameterMgrPlatformConnector(
     const string &strConfigurationFilePath)
     : _pParameterMgrLogger(new CParameterMgrLogger<CParameterMgrPlatformConnector>(*this)),
       _pParameterMgr(new CParameterMgr(strConfigurationFilePath, *_pParameterMgrLogger)),
-      _bStarted(false), _pLogger(nullptr)
+      _bStarted(false), _pLogger(nullptr), _bAsynchronousLogging(false),
+      _logBufferCapacity(defaultLogBufferCapacity), _pClientLogger(nullptr), _pAsyncLogger(nullptr)
 {
 }
 
 CParameterMgrPlatformConnector::~CParameterMgrPlatformConnector()
 {
     delete _pParameterMgr;
+    // Flushes the pending logs
+    delete _pAsyncLogger;
+    delete _pClientLogger;
     delete _pParameterMgrLogger;
 }
 
@@ -100,9 +105,144 @@ ElementHandle *CParameterMgrPlatformConnector::createElementHandle(const string
 // Logging
 void CParameterMgrPlatformConnector::setLogger(CParameterMgrPlatformConnector::ILogger *pLogger)
 {
+    if (_pAsyncLogger != nullptr) {
+
+        // The pending logs go to the previous logger, which is not used any more afterwards
+        CParameterMgrLogger<ILogger> *pClientLogger =
+            pLogger != nullptr ? new CParameterMgrLogger<ILogger>(*pLogger) : nullptr;
+        _pAsyncLogger->setLogger(pClientLogger);
+        delete _pClientLogger;
+        _pClientLogger = pClientLogger;
+    }
     _pLogger = pLogger;
 }
 
+void CParameterMgrPlatformConnector::setLogLevel(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::debug:
+        _pParameterMgr->setLogLevel(core::log::Level::debug);
+        break;
+    case LogLevel::info:
+        _pParameterMgr->setLogLevel(core::log::Level::info);
+        break;
+    case LogLevel::warning:
+        _pParameterMgr->setLogLevel(core::log::Level::warning);
+        break;
+    }
+}
+
+CParameterMgrPlatformConnector::LogLevel CParameterMgrPlatformConnector::getLogLevel() const
+{
+    switch (_pParameterMgr->getLogLevel()) {
+    case core::log::Level::debug:
+        return LogLevel::debug;
+    case core::log::Level::info:
+        return LogLevel::info;
+    case core::log::Level::warning:
+        break;
+    }
+    return LogLevel::warning;
+}
+
+bool CParameterMgrPlatformConnector::setAsynchronousLogging(bool bAsynchronous, size_t capacity,
+                                                            string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not change the asynchronous logging policy while running";
+        return false;
+    }
+    if (bAsynchronous && capacity == 0) {
+
+        strError = "The asynchronous log buffer can not be empty";
+        return false;
+    }
+
+    _bAsynchronousLogging = bAsynchronous;
+    _logBufferCapacity = capacity;
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::getAsynchronousLogging() const
+{
+    return _bAsynchronousLogging;
+}
+
+size_t CParameterMgrPlatformConnector::getDroppedLogCount() const
+{
+    return _pAsyncLogger != nullptr ? _pAsyncLogger->getDroppedCount() : 0;
+}
+
+bool CParameterMgrPlatformConnector::setTracing(bool bEnabled, string &strError)
+{
+    return _pParameterMgr->setTracing(bEnabled, strError);
+}
+
+bool CParameterMgrPlatformConnector::getTracing() const
+{
+    return _pParameterMgr->isTracingOn();
+}
+
+void CParameterMgrPlatformConnector::setTraceHook(ITraceHook *pTraceHook)
+{
+    if (pTraceHook == nullptr) {
+
+        _pParameterMgr->setTraceHook(nullptr);
+        return;
+    }
+    _pParameterMgr->setTraceHook([pTraceHook](const core::trace::Event &event) {
+        pTraceHook->span(event.name, event.detail, event.start, event.duration);
+    });
+}
+
+void CParameterMgrPlatformConnector::writeChromeTrace(std::ostream &output) const
+{
+    _pParameterMgr->writeChromeTrace(output);
+}
+
+void CParameterMgrPlatformConnector::writeMetrics(std::ostream &output, bool bJson) const
+{
+    if (bJson) {
+
+        _pParameterMgr->getMetrics().writeJson(output);
+    } else {
+
+        _pParameterMgr->getMetrics().writeText(output);
+    }
+}
+
+void CParameterMgrPlatformConnector::resetMetrics()
+{
+    _pParameterMgr->getMetrics().reset();
+}
+
+void CParameterMgrPlatformConnector::writeStartupProfile(std::ostream &output) const
+{
+    _pParameterMgr->getStartupProfiler().write(output);
+}
+
+bool CParameterMgrPlatformConnector::startCriterionRecording(const string &path,
+                                                             string &strError)
+{
+    if (!_bStarted) {
+
+        strError = "Can not record criteria before start, as criteria may still be created";
+        return false;
+    }
+    return _pParameterMgr->startCriterionRecording(path, strError);
+}
+
+void CParameterMgrPlatformConnector::stopCriterionRecording()
+{
+    _pParameterMgr->stopCriterionRecording();
+}
+
+std::vector<string> CParameterMgrPlatformConnector::getAppliedConfigurations() const
+{
+    return _pParameterMgr->getAppliedConfigurations();
+}
+
 bool CParameterMgrPlatformConnector::getForceNoRemoteInterface() const
 {
     return _pParameterMgr->getForceNoRemoteInterface();
@@ -179,6 +319,16 @@ bool CParameterMgrPlatformConnector::getValidateSchemasOnStart() const
 // Start
 bool CParameterMgrPlatformConnector::start(string &strError)
 {
+    // Put the log buffer between the parameter framework and the client logger, even if there
+    // is none yet as it may be set while running
+    if (_bAsynchronousLogging && _pAsyncLogger == nullptr) {
+
+        if (_pLogger != nullptr) {
+            _pClientLogger = new CParameterMgrLogger<ILogger>(*_pLogger);
+        }
+        _pAsyncLogger = new core::log::AsyncLogger(_pClientLogger, _logBufferCapacity);
+    }
+
     // Create data structure
     if (!_pParameterMgr->load(strError)) {
 
@@ -199,7 +349,10 @@ bool CParameterMgrPlatformConnector::isStarted() const
 // Private logging
 void CParameterMgrPlatformConnector::info(const string &log)
 {
-    if (_pLogger) {
+    if (_pAsyncLogger) {
+
+        _pAsyncLogger->info(log);
+    } else if (_pLogger) {
 
         _pLogger->info(log);
     }
@@ -207,7 +360,10 @@ void CParameterMgrPlatformConnector::info(const string &log)
 
 void CParameterMgrPlatformConnector::warning(const string &log)
 {
-    if (_pLogger) {
+    if (_pAsyncLogger) {
+
+        _pAsyncLogger->warning(log);
+    } else if (_pLogger) {
 
         _pLogger->warning(log);
     }
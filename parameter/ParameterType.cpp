@@ -33,6 +33,7 @@
 #include "ParameterAccessContext.h"
 
 #include <climits>
+#include <cstring>
 
 #define base CTypeElement
 
@@ -273,3 +274,88 @@ bool CParameterType::fromBlackboard(double & /*dUserValue*/, uint32_t /*uiValue*
 
     return false;
 }
+
+// Bulk conversions
+// Integer
+bool CParameterType::bulkToBlackboard(const uint32_t *auiUserValues, size_t count, uint8_t *pData,
+                                      CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkToBlackboard(auiUserValues, count, pData, parameterAccessContext);
+}
+
+bool CParameterType::bulkFromBlackboard(uint32_t *auiUserValues, size_t count, const uint8_t *pData,
+                                        CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkFromBlackboard(auiUserValues, count, pData, parameterAccessContext);
+}
+
+// Signed Integer
+bool CParameterType::bulkToBlackboard(const int32_t *aiUserValues, size_t count, uint8_t *pData,
+                                      CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkToBlackboard(aiUserValues, count, pData, parameterAccessContext);
+}
+
+bool CParameterType::bulkFromBlackboard(int32_t *aiUserValues, size_t count, const uint8_t *pData,
+                                        CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkFromBlackboard(aiUserValues, count, pData, parameterAccessContext);
+}
+
+// Double
+bool CParameterType::bulkToBlackboard(const double *adUserValues, size_t count, uint8_t *pData,
+                                      CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkToBlackboard(adUserValues, count, pData, parameterAccessContext);
+}
+
+bool CParameterType::bulkFromBlackboard(double *adUserValues, size_t count, const uint8_t *pData,
+                                        CParameterAccessContext &parameterAccessContext) const
+{
+    return doBulkFromBlackboard(adUserValues, count, pData, parameterAccessContext);
+}
+
+// Generic bulk conversion, one scalar conversion per value
+template <typename type>
+bool CParameterType::doBulkToBlackboard(const type *userValues, size_t count, uint8_t *pData,
+                                        CParameterAccessContext &parameterAccessContext) const
+{
+    size_t size = getSize();
+
+    for (size_t valueIndex = 0; valueIndex < count; valueIndex++) {
+
+        uint32_t uiData;
+
+        if (!toBlackboard(userValues[valueIndex], uiData, parameterAccessContext)) {
+
+            return false;
+        }
+        // Beware this code works on little endian architectures only!
+        memcpy(pData, &uiData, size);
+
+        pData += size;
+    }
+    return true;
+}
+
+template <typename type>
+bool CParameterType::doBulkFromBlackboard(type *userValues, size_t count, const uint8_t *pData,
+                                          CParameterAccessContext &parameterAccessContext) const
+{
+    size_t size = getSize();
+
+    for (size_t valueIndex = 0; valueIndex < count; valueIndex++) {
+
+        uint32_t uiData = 0;
+
+        // Beware this code works on little endian architectures only!
+        memcpy(&uiData, pData, size);
+
+        if (!fromBlackboard(userValues[valueIndex], uiData, parameterAccessContext)) {
+
+            return false;
+        }
+        pData += size;
+    }
+    return true;
+}
@@ -88,6 +88,33 @@ public:
     virtual bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                                 CParameterAccessContext &parameterAccessContext) const;
 
+    /** Bulk conversions of a whole array
+     *
+     * pData points to count consecutive values of getSize() bytes each, ie the
+     * blackboard layout of an array parameter.
+     * Specialized types check every value before writing any of them in pData.
+     * The default implementations fall back on the scalar conversions.
+     *
+     * @return true on success, false otherwise (the error is set in the context)
+     * @{
+     */
+    // Integer
+    virtual bool bulkToBlackboard(const uint32_t *auiUserValues, size_t count, uint8_t *pData,
+                                  CParameterAccessContext &parameterAccessContext) const;
+    virtual bool bulkFromBlackboard(uint32_t *auiUserValues, size_t count, const uint8_t *pData,
+                                    CParameterAccessContext &parameterAccessContext) const;
+    // Signed Integer
+    virtual bool bulkToBlackboard(const int32_t *aiUserValues, size_t count, uint8_t *pData,
+                                  CParameterAccessContext &parameterAccessContext) const;
+    virtual bool bulkFromBlackboard(int32_t *aiUserValues, size_t count, const uint8_t *pData,
+                                    CParameterAccessContext &parameterAccessContext) const;
+    // Double
+    virtual bool bulkToBlackboard(const double *adUserValues, size_t count, uint8_t *pData,
+                                  CParameterAccessContext &parameterAccessContext) const;
+    virtual bool bulkFromBlackboard(double *adUserValues, size_t count, const uint8_t *pData,
+                                    CParameterAccessContext &parameterAccessContext) const;
+    /** @} */
+
     /** Value space handling for settings import/export from/to XML
      *
      * During export, this method set the "ValueSpace" attribute of the future
@@ -158,6 +185,12 @@ private:
     void doSignExtend(type &data) const;
     template <typename type>
     bool doIsEncodable(type data, bool bIsSigned) const;
+    template <typename type>
+    bool doBulkToBlackboard(const type *userValues, size_t count, uint8_t *pData,
+                            CParameterAccessContext &parameterAccessContext) const;
+    template <typename type>
+    bool doBulkFromBlackboard(type *userValues, size_t count, const uint8_t *pData,
+                              CParameterAccessContext &parameterAccessContext) const;
 
     // Size in bytes
     size_t _size{0};
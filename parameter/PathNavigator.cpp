@@ -31,17 +31,8 @@
 #include "Tokenizer.h"
 
 CPathNavigator::CPathNavigator(const std::string &strPath)
+    : _strPath(strPath), _tokenizer(strPath, "/"), _bValid(checkPathFormat(strPath))
 {
-    init(strPath);
-}
-
-void CPathNavigator::init(const std::string &strPath)
-{
-    Tokenizer tokenizer(strPath, "/");
-
-    _astrItems = tokenizer.split();
-
-    _bValid = checkPathFormat(strPath);
 }
 
 bool CPathNavigator::isPathValid() const
@@ -82,9 +73,11 @@ bool CPathNavigator::navigateThrough(const std::string &strItemName, std::string
 
 std::string *CPathNavigator::next()
 {
-    if (_currentIndex < _astrItems.size()) {
+    if (_tokenizer.next(_strCurrentItem)) {
+
+        _currentIndex++;
 
-        return &_astrItems[_currentIndex++];
+        return &_strCurrentItem;
     }
 
     return nullptr;
@@ -94,19 +87,20 @@ std::string CPathNavigator::getCurrentPath() const
 {
     std::string strPath = "/";
 
-    if (!_currentIndex) {
+    // Items are not stored: read them again (only needed to report errors)
+    Tokenizer tokenizer(_strPath, "/");
+    size_t first;
+    size_t length;
 
-        return strPath;
-    }
+    for (size_t item = 0; item < _currentIndex && tokenizer.next(first, length); item++) {
 
-    size_t item;
-    for (item = 0; item < _currentIndex - 1; item++) {
+        if (item) {
 
-        strPath += _astrItems[item] + "/";
+            strPath += "/";
+        }
+        strPath.append(_strPath, first, length);
     }
 
-    strPath += _astrItems[item];
-
     return strPath;
 }
 
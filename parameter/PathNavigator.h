@@ -29,14 +29,18 @@
  */
 #pragma once
 
-#include <vector>
+#include "Tokenizer.h"
+
 #include <string>
 #include <stdint.h>
 
 class CPathNavigator
 {
 public:
+    /** @param[in] strPath the path to navigate, which is not copied: it must
+     *             outlive the navigator */
     CPathNavigator(const std::string &strPath);
+    CPathNavigator(std::string &&strPath) = delete;
 
     // Path validity
     bool isPathValid() const;
@@ -44,17 +48,19 @@ public:
     // Navigate through
     bool navigateThrough(const std::string &strItemName, std::string &strError);
 
-    // Nagivate
+    // Nagivate (the returned item is only valid until the next call)
     std::string *next();
 
     // Current path
     std::string getCurrentPath() const;
 
 private:
-    void init(const std::string &strPath);
     static bool checkPathFormat(const std::string &strUpl);
 
+    const std::string &_strPath;
+    Tokenizer _tokenizer;
     bool _bValid;
-    std::vector<std::string> _astrItems;
+    // Storage of the current item, reused from one item to the other
+    std::string _strCurrentItem;
     size_t _currentIndex{0};
 };
@@ -58,6 +58,11 @@ void CSelectionCriterion::resetModifiedStatus()
     _uiNbModifications = 0;
 }
 
+void CSelectionCriterion::setChangeObserver(ChangeObserver observer)
+{
+    _changeObserver = observer;
+}
+
 /// From ISelectionCriterionInterface
 // State
 void CSelectionCriterion::setCriterionState(int iState)
@@ -67,8 +72,12 @@ void CSelectionCriterion::setCriterionState(int iState)
 
         _iState = iState;
 
-        _logger.info() << "Selection criterion changed event: "
-                       << getFormattedDescription(false, false);
+        // Describing the criterion is costly, do it only if it is to be logged
+        if (_logger.isEnabled(core::log::Level::info)) {
+
+            _logger.info() << "Selection criterion changed event: "
+                           << getFormattedDescription(false, false);
+        }
 
         // Check if the previous criterion value has been taken into account (i.e. at least one
         // Configuration was applied
@@ -82,6 +91,10 @@ void CSelectionCriterion::setCriterionState(int iState)
 
         // Track the number of modifications for this criterion
         _uiNbModifications++;
+
+        if (_changeObserver) {
+            _changeObserver(*this);
+        }
     }
 }
 
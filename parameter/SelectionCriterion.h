@@ -35,6 +35,7 @@
 #include <log/Logger.h>
 #include <NonCopyable.hpp>
 
+#include <functional>
 #include <string>
 
 class CSelectionCriterion : public CElement,
@@ -57,6 +58,10 @@ public:
     bool hasBeenModified() const;
     void resetModifiedStatus();
 
+    /** Called after each change of the criterion state */
+    using ChangeObserver = std::function<void(const CSelectionCriterion &)>;
+    void setChangeObserver(ChangeObserver observer);
+
     /// Match methods
     bool is(int iState) const;
     bool isNot(int iState) const;
@@ -89,4 +94,6 @@ private:
 
     /** Application logger */
     core::log::Logger &_logger;
+
+    ChangeObserver _changeObserver;
 };
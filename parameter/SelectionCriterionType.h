@@ -60,6 +60,9 @@ public:
     // Value list
     std::string listPossibleValues() const;
 
+    /** @return the literal values and their numerical values */
+    const std::map<std::string, int> &getValuePairs() const { return _numToLitMap; }
+
     // Formatted state
     std::string getFormattedState(int iValue) const override;
 
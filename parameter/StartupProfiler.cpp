@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StartupProfiler.h"
+
+#include <iomanip>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define PFW_HAS_MALLINFO2
+#endif
+
+namespace core
+{
+namespace profiling
+{
+
+StartupProfiler::StartupProfiler(Counter counter) : mCounter(std::move(counter))
+{
+}
+
+bool StartupProfiler::isAllocationTrackingSupported()
+{
+#ifdef PFW_HAS_MALLINFO2
+    return true;
+#else
+    return false;
+#endif
+}
+
+int64_t StartupProfiler::getAllocatedBytes()
+{
+#ifdef PFW_HAS_MALLINFO2
+    struct mallinfo2 info = mallinfo2();
+    // Bytes in use in the arenas and in separately mmapped chunks
+    return static_cast<int64_t>(info.uordblks + info.hblkhd);
+#else
+    return 0;
+#endif
+}
+
+void StartupProfiler::clear()
+{
+    mPhases.clear();
+}
+
+void StartupProfiler::write(std::ostream &output) const
+{
+    Phase total{"total", 0, 0, 0, 0, 0};
+    for (auto &phase : mPhases) {
+        total.wallTime += phase.wallTime;
+        total.cpuTime += phase.cpuTime;
+        total.allocatedBytes += phase.allocatedBytes;
+        total.elements = phase.elements;
+        total.configurations = phase.configurations;
+    }
+
+    output << "Startup phases: wall (us) cpu (us) allocated (bytes) elements configurations\n";
+    auto writePhase = [&output](const Phase &phase) {
+        output << "    " << std::left << std::setw(24) << phase.name << std::right << " "
+               << std::setw(10) << phase.wallTime << " " << std::setw(10) << phase.cpuTime << " "
+               << std::setw(12) << phase.allocatedBytes << " " << std::setw(8) << phase.elements
+               << " " << std::setw(8) << phase.configurations << "\n";
+    };
+    for (auto &phase : mPhases) {
+        writePhase(phase);
+    }
+    writePhase(total);
+
+    if (!isAllocationTrackingSupported()) {
+        output << "Allocated bytes are not tracked on this platform\n";
+    }
+}
+
+StartupProfiler::Scope::Scope(StartupProfiler &profiler, const char *name)
+    : mProfiler(profiler), mName(name), mWallStart(std::chrono::steady_clock::now()),
+      mCpuStart(std::clock()), mAllocatedStart(getAllocatedBytes())
+{
+}
+
+StartupProfiler::Scope::~Scope()
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    Phase phase{mName, 0, 0, 0, 0, 0};
+    phase.wallTime = static_cast<uint64_t>(
+        duration_cast<microseconds>(std::chrono::steady_clock::now() - mWallStart).count());
+    phase.cpuTime = static_cast<uint64_t>(std::clock() - mCpuStart) * 1000000 / CLOCKS_PER_SEC;
+    phase.allocatedBytes = getAllocatedBytes() - mAllocatedStart;
+    if (mProfiler.mCounter) {
+        mProfiler.mCounter(phase.elements, phase.configurations);
+    }
+    mProfiler.mPhases.push_back(std::move(phase));
+}
+
+} // namespace profiling
+} // namespace core
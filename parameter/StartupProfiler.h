@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace core
+{
+namespace profiling
+{
+
+/** Profile of the successive phases of the parameter framework start
+ *
+ * Each phase records its wall time, the CPU time of the process, the heap growth and the
+ * number of elements and configurations in the tree at its end.
+ * Recording is not thread safe, the start being done by a single thread.
+ */
+class StartupProfiler : private utility::NonCopyable
+{
+public:
+    struct Phase
+    {
+        std::string name;
+        uint64_t wallTime;      /**< in microseconds */
+        uint64_t cpuTime;       /**< CPU time of the whole process in microseconds */
+        int64_t allocatedBytes; /**< heap growth, 0 if allocation tracking is not supported */
+        size_t elements;        /**< number of elements at the end of the phase */
+        size_t configurations;  /**< number of domain configurations at the end of the phase */
+    };
+
+    /** Count the elements and the domain configurations */
+    using Counter = std::function<void(size_t &elements, size_t &configurations)>;
+
+    explicit StartupProfiler(Counter counter);
+
+    /** @return true if the heap growth can be measured on this platform */
+    static bool isAllocationTrackingSupported();
+
+    /** Forget all recorded phases */
+    void clear();
+
+    const std::vector<Phase> &getPhases() const { return mPhases; }
+
+    /** Write the phases and their total as human readable text. */
+    void write(std::ostream &output) const;
+
+    /** Record a phase lasting for the scope lifetime, even if it is left on failure. */
+    class Scope : private utility::NonCopyable
+    {
+    public:
+        Scope(StartupProfiler &profiler, const char *name);
+        ~Scope();
+
+    private:
+        StartupProfiler &mProfiler;
+        const char *mName;
+        std::chrono::steady_clock::time_point mWallStart;
+        std::clock_t mCpuStart;
+        int64_t mAllocatedStart;
+    };
+
+private:
+    /** @return the number of bytes currently allocated on the heap */
+    static int64_t getAllocatedBytes();
+
+    Counter mCounter;
+    std::vector<Phase> mPhases;
+};
+
+} // namespace profiling
+} // namespace core
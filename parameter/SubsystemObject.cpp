@@ -34,6 +34,8 @@
 #include "ParameterAccessContext.h"
 #include "MappingContext.h"
 #include "ParameterType.h"
+#include "Tracer.h"
+#include "Metrics.h"
 #include "convert.hpp"
 #include <assert.h>
 #include <stdlib.h>
@@ -128,7 +130,15 @@ bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBac
     }
 
     // Synchronize to/from HW
-    if (!bIsSubsystemAlive || !accessHW(bBack, strError)) {
+    PFW_TRACE_SPAN(bBack ? "receiveFromHW" : "sendToHW", _pInstanceConfigurableElement->getPath());
+    core::metrics::Registry::Timer metricsTimer;
+    bool bSuccess = bIsSubsystemAlive && accessHW(bBack, strError);
+    if (metricsTimer.registry != nullptr) {
+
+        metricsTimer.registry->recordSync(pSubsystem->getName(), bSuccess, metricsTimer.elapsed());
+    }
+
+    if (!bSuccess) {
 
         // Fall back to parameter default initialization
         if (bBack) {
@@ -29,6 +29,8 @@
  */
 #include "SyncerSet.h"
 #include "Syncer.h"
+#include "Tracer.h"
+#include <string>
 
 const CSyncerSet &CSyncerSet::operator+=(ISyncer *pRightSyncer)
 {
@@ -59,6 +61,10 @@ bool CSyncerSet::sync(CParameterBlackboard &parameterBlackboard, bool bBack,
 
     std::string strError;
 
+    // Traced as a whole, each subsystem object tracing its own synchronization with its path
+    PFW_TRACE_SPAN("sync", std::string(bBack ? "receive" : "send") + ", syncers: " +
+                               std::to_string(_syncerSet.size()));
+
     // Propagate
     SyncerSetConstIterator it;
 
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Tracer.h"
+#include "Utility.h"
+
+#include <atomic>
+#include <thread>
+
+namespace core
+{
+namespace trace
+{
+
+/** Tracer activated in the calling thread */
+static thread_local Tracer *currentTracer = nullptr;
+
+/** @return a small identifier of the calling thread, stable for its lifetime */
+static uint64_t currentThread()
+{
+    static std::atomic<uint64_t> threadCount{0};
+    static thread_local uint64_t thread = ++threadCount;
+    return thread;
+}
+
+Tracer::Tracer(size_t capacity) : mOrigin(std::chrono::steady_clock::now()), mCapacity(capacity)
+{
+}
+
+bool Tracer::isSupported()
+{
+#ifdef PFW_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Tracer::setEnabled(bool bEnabled)
+{
+    if (bEnabled && !isSupported()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEnabled = bEnabled;
+    return true;
+}
+
+bool Tracer::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEnabled;
+}
+
+void Tracer::setHook(Hook hook)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mHook = hook;
+}
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEvents.clear();
+    mNext = 0;
+}
+
+void Tracer::writeChromeTrace(std::ostream &output) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    output << "{\"traceEvents\":[";
+    // Once the ring is full, the oldest span is the next to be overwritten
+    size_t first = mEvents.size() < mCapacity ? 0 : mNext;
+    for (size_t index = 0; index < mEvents.size(); ++index) {
+        const Event &event = mEvents[(first + index) % mEvents.size()];
+
+        output << (index == 0 ? "\n" : ",\n") << "{\"name\":" << utility::asJsonString(event.name)
+               << ",\"cat\":\"pfw\",\"ph\":\"X\",\"ts\":" << event.start
+               << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":" << event.thread;
+        if (!event.detail.empty()) {
+            output << ",\"args\":{\"detail\":" << utility::asJsonString(event.detail) << "}";
+        }
+        output << "}";
+    }
+    output << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+Tracer *Tracer::current()
+{
+    return currentTracer;
+}
+
+void Tracer::record(Event &&event)
+{
+    // The hook is called unlocked, so that it may use the tracer
+    Hook hook;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        hook = mHook;
+    }
+    if (hook) {
+        hook(event);
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mCapacity == 0) {
+        return;
+    }
+    if (mEvents.size() < mCapacity) {
+        mEvents.push_back(std::move(event));
+    } else {
+        mEvents[mNext] = std::move(event);
+    }
+    mNext = (mNext + 1) % mCapacity;
+}
+
+uint64_t Tracer::now() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - mOrigin)
+                                     .count());
+}
+
+Tracer::Activation::Activation(Tracer &tracer) : mPrevious(currentTracer)
+{
+    if (tracer.isEnabled()) {
+        currentTracer = &tracer;
+    }
+}
+
+Tracer::Activation::~Activation()
+{
+    currentTracer = mPrevious;
+}
+
+Tracer::Span::Span(const char *name, std::string detail)
+    : mTracer(currentTracer), mName(name), mDetail(std::move(detail)),
+      mStart(mTracer != nullptr ? mTracer->now() : 0)
+{
+}
+
+Tracer::Span::~Span()
+{
+    if (mTracer != nullptr) {
+        uint64_t end = mTracer->now();
+        mTracer->record({mName, std::move(mDetail), currentThread(), mStart, end - mStart});
+    }
+}
+
+} // namespace trace
+} // namespace core
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace core
+{
+namespace trace
+{
+
+/** A traced span of time */
+struct Event
+{
+    /** Static name of the traced step */
+    const char *name;
+    /** What the step worked on, may be empty */
+    std::string detail;
+    /** Identifier of the thread which ran the step */
+    uint64_t thread;
+    /** Start of the step in microseconds since the creation of the tracer */
+    uint64_t start;
+    /** Duration of the step in microseconds */
+    uint64_t duration;
+};
+
+/** Records spans of the apply pipeline in a bounded in-memory ring
+ *
+ * Spans are only recorded while the tracer is enabled and activated in the
+ * calling thread, @see Activation. When full, the oldest spans are overwritten.
+ * The recorded spans can be dumped as Chrome trace event JSON, to be loaded in
+ * chrome://tracing or any compatible viewer.
+ *
+ * Recording is built only if PFW_TRACING is defined, otherwise the tracer never
+ * records anything and can not be enabled.
+ */
+class Tracer : private utility::NonCopyable
+{
+public:
+    /** Callback called on each recorded span, from the traced thread
+     *
+     * It is called without the tracer lock, so may use the tracer, but may
+     * still be called once after having been replaced.
+     */
+    using Hook = std::function<void(const Event &)>;
+
+    /** @param[in] capacity maximum number of recorded spans */
+    Tracer(size_t capacity);
+
+    /** @return true if tracing support is built */
+    static bool isSupported();
+
+    /** Enable or disable recording
+     *
+     * @param[in] bEnabled true to record spans
+     * @return false if tracing is not supported, true otherwise
+     */
+    bool setEnabled(bool bEnabled);
+    bool isEnabled() const;
+
+    /** @param[in] hook called on each recorded span, may be empty */
+    void setHook(Hook hook);
+
+    /** Forget all recorded spans */
+    void clear();
+
+    /** Write recorded spans as Chrome trace event JSON
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeChromeTrace(std::ostream &output) const;
+
+    /** @return the tracer activated in the calling thread, nullptr if none */
+    static Tracer *current();
+
+    /** Record a span, called by the Span destructor
+     *
+     * @param[in] event the span to record
+     */
+    void record(Event &&event);
+
+    /** @return the time in microseconds since the creation of the tracer */
+    uint64_t now() const;
+
+    /** Set the tracer of the calling thread if enabled, for the lifetime of the activation */
+    class Activation : private utility::NonCopyable
+    {
+    public:
+        Activation(Tracer &tracer);
+        ~Activation();
+
+    private:
+        Tracer *mPrevious;
+    };
+
+    /** Trace the lifetime of the span if a tracer is activated in the calling thread */
+    class Span : private utility::NonCopyable
+    {
+    public:
+        /**
+         * @param[in] name static name of the traced step
+         * @param[in] detail what the step works on
+         */
+        Span(const char *name, std::string detail = "");
+        ~Span();
+
+    private:
+        Tracer *mTracer;
+        const char *mName;
+        std::string mDetail;
+        uint64_t mStart;
+    };
+
+private:
+    /** Creation time, origin of the event timestamps */
+    const std::chrono::steady_clock::time_point mOrigin;
+
+    /** Guards the ring, the hook and the enabled state */
+    mutable std::mutex mMutex;
+    bool mEnabled{false};
+    Hook mHook;
+
+    /** Ring of recorded spans, mNext is the position of the next record */
+    std::vector<Event> mEvents;
+    size_t mCapacity;
+    size_t mNext{0};
+};
+
+} // namespace trace
+} // namespace core
+
+/** Trace macros, expanding to nothing if tracing support is not built
+ *
+ * PFW_TRACE_ACTIVATE(tracer) activates tracer in the current scope.
+ * PFW_TRACE_SPAN(name, detail) traces the current scope, detail is only built if
+ * a tracer is activated. Each macro should be called only once in a scope.
+ */
+#ifdef PFW_TRACING
+#define PFW_TRACE_ACTIVATE(tracer) core::trace::Tracer::Activation traceActivation(tracer)
+#define PFW_TRACE_SPAN(name, detail)                                                               \
+    core::trace::Tracer::Span traceSpan(                                                           \
+        name, core::trace::Tracer::current() != nullptr ? std::string(detail) : std::string())
+#else
+#define PFW_TRACE_ACTIVATE(tracer)
+#define PFW_TRACE_SPAN(name, detail)
+#endif
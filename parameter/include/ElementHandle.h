@@ -215,6 +215,23 @@ public:
     bool getAsDoubleArray(std::vector<double> &value, std::string &error) const;
     /** @} */
 
+    /** Bulk array access through caller-owned buffers @{
+     *
+     * Allocation free alternative to the std::vector based array accessors:
+     * the whole array is converted in one pass and written to the parameter
+     * at once. No value is written if any of them is invalid.
+     *
+     * @param[in] values the buffer to read (set) or to fill (get)
+     * @param[in] length the buffer length, must match getArrayLength()
+     */
+    bool setAsIntegerBuffer(const uint32_t *values, size_t length, std::string &error);
+    bool getAsIntegerBuffer(uint32_t *values, size_t length, std::string &error) const;
+    bool setAsSignedIntegerBuffer(const int32_t *values, size_t length, std::string &error);
+    bool getAsSignedIntegerBuffer(int32_t *values, size_t length, std::string &error) const;
+    bool setAsDoubleBuffer(const double *values, size_t length, std::string &error);
+    bool getAsDoubleBuffer(double *values, size_t length, std::string &error) const;
+    /** @} */
+
     /** String Access @{ */
     bool setAsString(const std::string &value, std::string &error);
     bool getAsString(std::string &value, std::string &error) const;
@@ -233,6 +250,10 @@ private:
     bool setAs(const T value, std::string &error) const;
     template <class T>
     bool getAs(T &value, std::string &error) const;
+    template <class T>
+    bool setAsBuffer(const T *values, size_t length, std::string &error) const;
+    template <class T>
+    bool getAsBuffer(T *values, size_t length, std::string &error) const;
 
     CBaseParameter &getParameter();
     const CBaseParameter &getParameter() const;
@@ -37,7 +37,19 @@
 #include "ElementHandle.h"
 #include "ParameterMgrLoggerForward.h"
 
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
 class CParameterMgr;
+namespace core
+{
+namespace log
+{
+class AsyncLogger;
+} // namespace log
+} // namespace core
 
 class PARAMETER_EXPORT CParameterMgrPlatformConnector
 {
@@ -61,6 +73,48 @@ public:
         virtual ~ILogger() {}
     };
 
+    /** Interface to implement to receive the traced steps of configuration application.
+     *
+     * Steps are named "applyConfigurations", "evaluate", "restore", "sync",
+     * "sendToHW" and "receiveFromHW". They are provided when they end, from the
+     * thread which ran them. The "sync" of a set of syncers is detailed with its
+     * direction and its syncer count, e.g. "send, syncers: 3", the "sendToHW" and
+     * "receiveFromHW" of each subsystem object with its path.
+     *
+     * Steps run with the blackboard lock held: the hook may use the tracing API
+     * (setTracing, setTraceHook, writeChromeTrace) but must not use any API which
+     * takes this lock, such as applyConfigurations or parameter handles, else it
+     * deadlocks. It should return quickly as configuration application waits for
+     * it. When removed from another thread, it may still receive a step ending
+     * concurrently.
+     */
+    class ITraceHook
+    {
+    public:
+        /**
+         * @param[in] name the name of the step
+         * @param[in] detail what the step worked on, may be empty
+         * @param[in] start start of the step in microseconds, from an arbitrary origin
+         * @param[in] duration duration of the step in microseconds
+         */
+        virtual void span(const std::string &name, const std::string &detail, uint64_t start,
+                          uint64_t duration) = 0;
+
+    protected:
+        virtual ~ITraceHook() {}
+    };
+
+    /** Log levels, from the most to the least verbose.
+     *
+     * Debug logs are forwarded to ILogger::info.
+     */
+    enum class LogLevel
+    {
+        debug,
+        info,
+        warning
+    };
+
     // Construction
     CParameterMgrPlatformConnector(const std::string &strConfigurationFilePath);
     virtual ~CParameterMgrPlatformConnector();
@@ -75,10 +129,137 @@ public:
     // Selection criterion retrieval
     ISelectionCriterionInterface *getSelectionCriterion(const std::string &strName) const;
 
-    // Logging
-    // Should be called before start
+    /** Set the logger the logs are forwarded to.
+     *
+     * May be called at any time, nullptr discards the next logs.
+     * With asynchronous logging, the pending logs are first forwarded to the previous
+     * logger. In any case, once this returns the previous logger is not called any more
+     * and can be destroyed.
+     * Must not be called from a logger callback.
+     *
+     * @param[in] pLogger the logger, lent to the connector
+     */
     void setLogger(ILogger *pLogger);
 
+    /** Set the minimum level of the logs forwarded to the logger.
+     *
+     * Logs below this level are discarded before being formatted.
+     * May be called at any time, the default level is LogLevel::info.
+     *
+     * @param[in] level the minimum level to forward
+     */
+    void setLogLevel(LogLevel level);
+
+    /** @return the minimum level of the logs forwarded to the logger */
+    LogLevel getLogLevel() const;
+
+    /** Default maximum number of logs waiting to be forwarded */
+    static const size_t defaultLogBufferCapacity = 1024;
+
+    /** Should logs be forwarded to the logger from a background thread.
+     *
+     * Logs are then pushed in a bounded buffer drained by a dedicated thread,
+     * so that a slow logger does not delay the parameter framework.
+     * Logs which do not fit in the buffer are dropped and counted.
+     * All pending logs are forwarded before the destruction of the connector, or before
+     * setLogger replaces the logger.
+     *
+     * Will fail if called on started instance.
+     *
+     * @param[in] bAsynchronous If set to true, logs are forwarded from a background thread.
+     *                          If set to false, logs are forwarded from the logging thread
+     *                          (default behaviour).
+     * @param[in] capacity maximum number of logs waiting to be forwarded,
+     *                     defaultLogBufferCapacity is a sensible value
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if unable to set, true otherwise.
+     */
+    bool setAsynchronousLogging(bool bAsynchronous, size_t capacity, std::string &strError);
+
+    /** Are logs forwarded from a background thread?
+     *
+     * @return the asynchronous logging policy state.
+     */
+    bool getAsynchronousLogging() const;
+
+    /** @return the number of logs dropped because the asynchronous log buffer was full */
+    size_t getDroppedLogCount() const;
+
+    // Tracing
+    /** Should the steps of configuration application be traced.
+     *
+     * Traced steps are kept in memory and given to the trace hook if any.
+     *
+     * @param[in] bEnabled true to trace configuration application
+     * @param[out] strError On error: an human readable error message
+     *                      On success: undefined
+     *
+     * @return false if tracing support is not built, true otherwise.
+     */
+    bool setTracing(bool bEnabled, std::string &strError);
+
+    /** @return true if configuration application is traced */
+    bool getTracing() const;
+
+    /** @param[in] pTraceHook receives each traced step, nullptr to remove it */
+    void setTraceHook(ITraceHook *pTraceHook);
+
+    /** Write the traced steps kept in memory as Chrome trace event JSON.
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeChromeTrace(std::ostream &output) const;
+
+    // Metrics
+    /** Write the metrics of the parameter framework.
+     *
+     * Counts configuration applications, evaluated domains, switched configurations,
+     * restored bytes and synchronizations per subsystem. Gives the latencies in
+     * microseconds of applications, synchronizations and parameter accesses.
+     *
+     * @param[out] output the stream to write to
+     * @param[in] bJson true to write a JSON object, false to write human readable text
+     */
+    void writeMetrics(std::ostream &output, bool bJson) const;
+
+    /** Reset all metrics */
+    void resetMetrics();
+
+    // Startup profile
+    /** Write the profile of the phases of the last start as human readable text.
+     *
+     * For each phase (framework configuration, subsystem plugins, structure, settings, init,
+     * back synchronization, validation, initial application and remote interface), gives
+     * the wall and CPU time in microseconds, the heap growth in bytes and the number of
+     * elements and domain configurations at the end of the phase.
+     *
+     * @param[out] output the stream to write to
+     */
+    void writeStartupProfile(std::ostream &output) const;
+
+    // Criterion recording
+    /** Record the criterion changes and the configuration applications to a compact binary
+     * file, to be replayed offline by criterionReplay.
+     *
+     * Must be called once started, when all criteria are created: the file starts with
+     * the definition and the current state of each criterion.
+     *
+     * @param[in] path the file to record to, overwritten if it exists
+     * @param[out] strError the error if not started or if the file can not be created
+     * @return true on success, false otherwise
+     */
+    bool startCriterionRecording(const std::string &path, std::string &strError);
+
+    /** Stop recording criterion changes and close the file, no-op if not recording */
+    void stopCriterionRecording();
+
+    /** @return the configuration last applied by each domain, as "<domain>/<configuration>",
+     *          in domain order, the domains which did not apply any being skipped
+     */
+    std::vector<std::string> getAppliedConfigurations() const;
+
     // Start
     bool start(std::string &strError);
 
@@ -203,4 +384,9 @@ protected:
     bool _bStarted;
     // Logging
     ILogger *_pLogger;
+    // Asynchronous logging
+    bool _bAsynchronousLogging;
+    size_t _logBufferCapacity;
+    CParameterMgrLogger<ILogger> *_pClientLogger;
+    core::log::AsyncLogger *_pAsyncLogger;
 };
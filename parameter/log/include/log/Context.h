@@ -37,7 +37,9 @@ namespace core
 namespace log
 {
 
-/** Log formatter which provide context indentation */
+/** Log formatter which provide context indentation
+ * Does nothing if information logs are disabled.
+ */
 class Context
 {
 public:
@@ -47,17 +49,23 @@ public:
      * @param[in] logger application logger
      * @param[in] context name of the context to open
      */
-    Context(Logger &logger, const std::string &context) : mLogger(logger)
+    Context(Logger &logger, const std::string &context)
+        : mLogger(logger), mEnabled(logger.isEnabled(Level::info))
     {
-        mLogger.info() << context << " {";
-        mLogger.mProlog += "    ";
+        if (mEnabled) {
+            mLogger.info() << context << " {";
+            mLogger.mProlog += "    ";
+        }
     }
 
     /** Class Destructor */
     ~Context()
     {
-        mLogger.mProlog.resize(mLogger.mProlog.size() - 4);
-        mLogger.info() << "}";
+        // Rely on the state at opening as the level may have changed since
+        if (mEnabled) {
+            mLogger.mProlog.resize(mLogger.mProlog.size() - 4);
+            mLogger.info() << "}";
+        }
     }
 
 private:
@@ -66,6 +74,9 @@ private:
 
     /** Application logger */
     Logger &mLogger;
+
+    /** Was the context opened */
+    const bool mEnabled;
 };
 
 } // namespace log
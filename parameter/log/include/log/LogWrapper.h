@@ -35,6 +35,7 @@
 #include <sstream>
 #include <iterator>
 #include <list>
+#include <memory>
 
 namespace core
 {
@@ -46,6 +47,7 @@ namespace details
 /**
  * Template log wrapper
  * Simulate a stream which can be used instead of basic ILogger API.
+ * A disabled wrapper discards what it is fed without formatting it.
  *
  * @tparam isWarning indicates which log canal to use
  */
@@ -53,8 +55,13 @@ template <bool isWarning>
 class LogWrapper
 {
 public:
-    /** @param logger the ILogger to wrap */
-    LogWrapper(ILogger &logger, const std::string &prolog = "") : mLogger(logger), mProlog(prolog)
+    /**
+     * @param logger the ILogger to wrap
+     * @param[in] prolog the prefix of each log line
+     * @param[in] enabled false if the log level is filtered out
+     */
+    LogWrapper(ILogger &logger, const std::string &prolog = "", bool enabled = true)
+        : mLogger(logger), mProlog(prolog), mEnabled(enabled)
     {
     }
 
@@ -64,18 +71,18 @@ public:
      * @param[in] logWrapper the instance to copy
      */
     LogWrapper(const LogWrapper &logWrapper)
-        : mLogger(logWrapper.mLogger), mProlog(logWrapper.mProlog)
+        : mLogger(logWrapper.mLogger), mProlog(logWrapper.mProlog), mEnabled(logWrapper.mEnabled)
     {
     }
 
     /** Class destructor */
     ~LogWrapper()
     {
-        if (!mLog.str().empty()) {
+        if (mLog != nullptr && !mLog->str().empty()) {
             if (isWarning) {
-                mLogger.warning(mProlog + mLog.str());
+                mLogger.warning(mProlog + mLog->str());
             } else {
-                mLogger.info(mProlog + mLog.str());
+                mLogger.info(mProlog + mLog->str());
             }
         }
     }
@@ -89,7 +96,9 @@ public:
     template <class T>
     LogWrapper &operator<<(const T &log)
     {
-        mLog << log;
+        if (mEnabled) {
+            stream() << log;
+        }
         return *this;
     }
 
@@ -100,11 +109,15 @@ public:
      */
     LogWrapper &operator<<(const std::list<std::string> &logs)
     {
+        if (!mEnabled || logs.empty()) {
+            return *this;
+        }
         std::string separator = "\n" + mProlog;
         std::string formatedLogs = utility::asString(logs, separator);
 
         // Check if there is something in the log to know if we have to add a prefix
-        if (!mLog.str().empty() && mLog.str()[mLog.str().length() - 1] == separator[0]) {
+        std::string current = stream().str();
+        if (!current.empty() && current[current.length() - 1] == separator[0]) {
             *this << mProlog;
         }
 
@@ -115,14 +128,26 @@ public:
 private:
     LogWrapper &operator=(const LogWrapper &);
 
-    /** Log stream holder */
-    std::ostringstream mLog;
+    /** @return the log stream, created on first use */
+    std::ostringstream &stream()
+    {
+        if (mLog == nullptr) {
+            mLog.reset(new std::ostringstream);
+        }
+        return *mLog;
+    }
+
+    /** Log stream holder, only allocated when something is logged */
+    std::unique_ptr<std::ostringstream> mLog;
 
     /** Wrapped logger */
     ILogger &mLogger;
 
     /** Log Prefix */
     const std::string &mProlog;
+
+    /** Is the log level of this wrapper enabled */
+    const bool mEnabled;
 };
 
 /** Default information logger type */
@@ -131,6 +156,9 @@ typedef details::LogWrapper<false> Info;
 /** Default warning logger type */
 typedef details::LogWrapper<true> Warning;
 
+/** Debug logger type, debug logs are forwarded to the information canal */
+typedef details::LogWrapper<false> Debug;
+
 } // namespace details
 } // namespace log
 } // namespace core
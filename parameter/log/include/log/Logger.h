@@ -34,11 +34,21 @@
 
 #include "NonCopyable.hpp"
 
+#include <atomic>
+
 namespace core
 {
 namespace log
 {
 
+/** Log levels, from the most to the least verbose */
+enum class Level
+{
+    debug,
+    info,
+    warning
+};
+
 /** Application logger object (Thread unsafe)
  * Provide contextualisable logging API.
  * Streams can be used through Info and Warning objects returned by dedicated
@@ -52,21 +62,50 @@ public:
     friend class Context;
 
     /** @param[in] logger raw logger provided by client */
-    Logger(ILogger &logger) : mLogger(logger) {}
+    Logger(ILogger &logger) : mLogger(logger), mLevel(Level::info) {}
+
+    /**
+     * Set the minimum level of the logs to emit
+     * Logs below this level are neither formatted nor forwarded to the raw logger.
+     *
+     * @param[in] level the minimum level to emit
+     */
+    void setLevel(Level level) { mLevel = level; }
+
+    /** @return the minimum level of the emitted logs */
+    Level getLevel() const { return mLevel; }
+
+    /**
+     * Check a level before building an expensive log
+     *
+     * @param[in] level the level to check
+     * @return true if logs of this level are emitted
+     */
+    bool isEnabled(Level level) const { return level >= mLevel; }
+
+    /**
+     * Retrieve wrapped debug logger
+     *
+     * @return Debug logger
+     */
+    details::Debug debug() { return details::Debug(mLogger, mProlog, isEnabled(Level::debug)); }
 
     /**
      * Retrieve wrapped information logger
      *
      * @return Info logger
      */
-    details::Info info() { return details::Info(mLogger, mProlog); }
+    details::Info info() { return details::Info(mLogger, mProlog, isEnabled(Level::info)); }
 
     /**
      * Retrieve wrapped warning logger
      *
      * @return Warning logger
      */
-    details::Warning warning() { return details::Warning(mLogger, mProlog); }
+    details::Warning warning()
+    {
+        return details::Warning(mLogger, mProlog, isEnabled(Level::warning));
+    }
 
 private:
     /** Raw logger provided by client */
@@ -74,6 +113,9 @@ private:
 
     /** Log prolog, owns the context indentation */
     std::string mProlog;
+
+    /** Minimum emitted level, may be changed by another thread while logging */
+    std::atomic<Level> mLevel;
 };
 
 } // namespace log
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <asio.hpp>
+#include <string>
+
+/** Connect to host:port through TCP, or to a Unix domain socket if host is "--unix"
+ *
+ * @param[in] port the port number, or the socket path for a Unix domain socket
+ */
+inline void connect(asio::io_service &io_service, asio::generic::stream_protocol::socket &socket,
+                    const std::string &host, const std::string &port)
+{
+    if (host == "--unix") {
+        socket.connect(asio::local::stream_protocol::endpoint(port));
+        return;
+    }
+
+    using asio::ip::tcp;
+    tcp::resolver resolver(io_service);
+
+    // Try all resolved endpoints until one accepts the connection
+    asio::error_code ec = asio::error::host_not_found;
+    tcp::resolver::iterator end;
+
+    for (auto it = resolver.resolve(tcp::resolver::query(host, port)); ec && it != end; ++it) {
+
+        socket.close();
+        socket.connect(asio::generic::stream_protocol::endpoint(it->endpoint()), ec);
+    }
+    if (ec) {
+        throw asio::system_error(ec);
+    }
+}
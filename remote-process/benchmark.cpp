@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Load generator measuring the throughput and latencies of the remote interface
+ *
+ * Several clients, each on its own connection and thread, send operations
+ * drawn from a weighted mix, as fast as answered, for a given duration.
+ */
+
+#include <asio.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RequestMessage.h"
+#include "AnswerMessage.h"
+#include "Socket.h"
+#include "Connect.hpp"
+#include "Tokenizer.h"
+#include "Utility.h"
+#include "convert.hpp"
+
+using namespace std;
+
+using Clock = std::chrono::steady_clock;
+
+/** A command and its arguments */
+using Command = vector<string>;
+/** Commands sent in sequence, timed as a whole */
+using Sequence = vector<Command>;
+
+/** An entry of the operation mix */
+struct Operation
+{
+    /** The mix line, naming the operation in the report */
+    string name;
+    unsigned weight;
+    /** Sent to test-platform rather than to the parameter-framework */
+    bool bPlatform;
+    /** Alternatives, used in turn */
+    vector<Sequence> variants;
+};
+
+/** Parse a mix line: "<weight> <kind> [arguments]"
+ *
+ * @return false, filling strError, if the line is invalid
+ */
+static bool parseOperation(const string &line, Operation &operation, string &strError)
+{
+    vector<string> words = Tokenizer(line).split();
+
+    if (words.size() < 2 || !convertTo(words[0], operation.weight) || operation.weight == 0) {
+
+        strError = "Expected a positive weight then an operation: " + line;
+        return false;
+    }
+    operation.name = line;
+    operation.bPlatform = false;
+
+    const string &kind = words[1];
+    vector<string> arguments(begin(words) + 2, end(words));
+
+    if (kind == "get" && arguments.size() == 1) {
+        operation.variants = {{{"getParameter", arguments[0]}}};
+    } else if (kind == "set" && arguments.size() == 2) {
+        operation.variants = {{{"setParameter", arguments[0], arguments[1]}}};
+    } else if (kind == "export" && arguments.empty()) {
+        operation.variants = {{{"getDomainsWithSettingsXML"}}};
+    } else if (kind == "criterion" && arguments.size() >= 2) {
+
+        // Cycle through the states, so that each one triggers an actual change
+        operation.bPlatform = true;
+        for (size_t state = 1; state < arguments.size(); state++) {
+
+            operation.variants.push_back({{"setCriterionState", arguments[0], arguments[state]},
+                                          {"applyConfigurations"}});
+        }
+    } else if (kind == "command" && !arguments.empty()) {
+        operation.variants = {{arguments}};
+    } else {
+        strError = "Unknown operation or wrong argument count: " + line;
+        return false;
+    }
+    return true;
+}
+
+/** A client connection, sending commands one at a time */
+class Connection
+{
+public:
+    Connection(asio::io_service &io_service) : _socket(io_service) {}
+
+    asio::generic::stream_protocol::socket &socket() { return _socket; }
+
+    /** Send a command and receive its whole answer
+     *
+     * @param[out] bSuccess whether the command succeeded
+     *
+     * @return false if the command could not be sent or answered
+     */
+    bool execute(const Command &command, bool &bSuccess, string &strError)
+    {
+        CRequestMessage requestMessage(command[0]);
+
+        for (size_t argument = 1; argument < command.size(); argument++) {
+            requestMessage.addArgument(command[argument]);
+        }
+        // Same as remote-process
+        requestMessage.acceptChunkedAnswer();
+        requestMessage.advertiseCompression();
+        if (_bAcceptsCompression) {
+            requestMessage.allowCompression();
+        }
+
+        if (requestMessage.serialize(Socket(_socket), true, strError) !=
+            CRequestMessage::success) {
+            return false;
+        }
+        _answerMessage.advertiseCompression();
+        do {
+            if (_answerMessage.serialize(Socket(_socket), false, strError) !=
+                CRequestMessage::success) {
+                return false;
+            }
+        } while (_answerMessage.isChunk());
+
+        _bAcceptsCompression = _answerMessage.peerAcceptsCompression();
+        bSuccess = _answerMessage.success();
+
+        return true;
+    }
+
+private:
+    asio::generic::stream_protocol::socket _socket;
+    CAnswerMessage _answerMessage;
+    bool _bAcceptsCompression{false};
+};
+
+/** Latencies and errors of an operation */
+struct Statistics
+{
+    void merge(const Statistics &other)
+    {
+        latencies.insert(end(latencies), begin(other.latencies), end(other.latencies));
+        errors += other.errors;
+    }
+
+    vector<Clock::duration> latencies;
+    size_t errors{0};
+};
+
+/** A client, with its connections and its statistics per operation */
+class Client
+{
+public:
+    Client(const vector<Operation> &operations, unsigned seed)
+        : _operations(operations), _statistics(operations.size()), _variants(operations.size()),
+          _random(seed)
+    {
+        vector<unsigned> weights;
+        for (const auto &operation : operations) {
+            weights.push_back(operation.weight);
+        }
+        _choice = discrete_distribution<size_t>(begin(weights), end(weights));
+    }
+
+    /** Connect to the parameter-framework and, if needed, to test-platform */
+    void connect(const string &host, const string &port, const string &platformHost,
+                 const string &platformPort)
+    {
+        _pfw.reset(new Connection(_io_service));
+        ::connect(_io_service, _pfw->socket(), host, port);
+
+        if (!platformHost.empty()) {
+            _platform.reset(new Connection(_io_service));
+            ::connect(_io_service, _platform->socket(), platformHost, platformPort);
+        }
+    }
+
+    /** Send operations until the deadline, or until a connection fails */
+    void run(Clock::time_point deadline)
+    {
+        string strError;
+
+        while (Clock::now() < deadline) {
+
+            size_t index = _choice(_random);
+            const Operation &operation = _operations[index];
+            const Sequence &sequence =
+                operation.variants[_variants[index]++ % operation.variants.size()];
+            Connection &connection = operation.bPlatform ? *_platform : *_pfw;
+
+            bool bSuccess = true;
+            Clock::time_point start = Clock::now();
+
+            for (const auto &command : sequence) {
+
+                bool bCommandSuccess;
+                if (!connection.execute(command, bCommandSuccess, strError)) {
+                    _strError = operation.name + ": " + strError;
+                    return;
+                }
+                bSuccess &= bCommandSuccess;
+            }
+            _statistics[index].latencies.push_back(Clock::now() - start);
+            if (!bSuccess) {
+                _statistics[index].errors++;
+            }
+        }
+    }
+
+    const vector<Statistics> &statistics() const { return _statistics; }
+
+    /** @return why the client stopped before the deadline, empty if it did not */
+    const string &error() const { return _strError; }
+
+private:
+    const vector<Operation> &_operations;
+    vector<Statistics> _statistics;
+    /** Next variant of each operation */
+    vector<size_t> _variants;
+
+    mt19937 _random;
+    discrete_distribution<size_t> _choice;
+
+    asio::io_service _io_service;
+    unique_ptr<Connection> _pfw;
+    unique_ptr<Connection> _platform;
+    string _strError;
+};
+
+static double toMicroseconds(Clock::duration duration)
+{
+    return chrono::duration<double, micro>(duration).count();
+}
+
+/** Nearest-rank percentile of sorted latencies */
+static double percentile(const vector<Clock::duration> &sorted, double rank)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = static_cast<size_t>(rank * static_cast<double>(sorted.size()));
+
+    return toMicroseconds(sorted[min(index, sorted.size() - 1)]);
+}
+
+/** Write count, errors, throughput and latency percentiles as JSON members */
+static void writeStatistics(ostream &output, Statistics &statistics, double seconds,
+                            const string &indent)
+{
+    auto &latencies = statistics.latencies;
+    sort(begin(latencies), end(latencies));
+
+    Clock::duration total{0};
+    for (const auto &latency : latencies) {
+        total += latency;
+    }
+    double mean =
+        latencies.empty() ? 0 : toMicroseconds(total) / static_cast<double>(latencies.size());
+
+    output << indent << "\"operations\": " << latencies.size() << ",\n"
+           << indent << "\"errors\": " << statistics.errors << ",\n"
+           << indent << "\"ops_per_s\": " << static_cast<double>(latencies.size()) / seconds
+           << ",\n"
+           << indent << "\"latency_us\": {\"mean\": " << mean
+           << ", \"p50\": " << percentile(latencies, 0.5)
+           << ", \"p99\": " << percentile(latencies, 0.99)
+           << ", \"p999\": " << percentile(latencies, 0.999)
+           << ", \"max\": " << (latencies.empty() ? 0 : toMicroseconds(latencies.back())) << "}";
+}
+
+static void showUsage(const char *name)
+{
+    cerr << "Usage: " << endl;
+    cerr << "\t" << name << " [--clients count] [--duration seconds]"
+         << " [--platform hostname port] hostname port mix-file" << endl;
+    cerr << "Connect to a Unix domain socket by replacing hostname and port with:" << endl;
+    cerr << "\t--unix socket-path" << endl;
+    cerr << "Each line of the mix file is a weight followed by an operation:" << endl;
+    cerr << "\tget <param path>" << endl;
+    cerr << "\tset <param path> <value>" << endl;
+    cerr << "\texport" << endl;
+    cerr << "\tcriterion <criterion name> <state> <state>..." << endl;
+    cerr << "\tcommand <command> [argument[s]]" << endl;
+    cerr << "Criteria are set, then configurations applied, through test-platform (see "
+         << "--platform), cycling through the given states." << endl;
+}
+
+static const size_t defaultClients = 1;
+static const unsigned defaultDuration = 10;
+
+int main(int argc, char *argv[])
+{
+    size_t clientCount = defaultClients;
+    unsigned duration = defaultDuration;
+    string platformHost;
+    string platformPort;
+    vector<string> positionals;
+
+    for (int arg = 1; arg < argc; arg++) {
+
+        string option(argv[arg]);
+
+        if (option == "--clients" && arg + 1 < argc) {
+            if (!convertTo(string(argv[++arg]), clientCount) || clientCount == 0) {
+                cerr << "Invalid client count: " << argv[arg] << endl;
+                return 1;
+            }
+        } else if (option == "--duration" && arg + 1 < argc) {
+            if (!convertTo(string(argv[++arg]), duration) || duration == 0) {
+                cerr << "Invalid duration: " << argv[arg] << endl;
+                return 1;
+            }
+        } else if (option == "--platform" && arg + 2 < argc) {
+            platformHost = argv[++arg];
+            platformPort = argv[++arg];
+        } else {
+            positionals.push_back(option);
+        }
+    }
+    if (positionals.size() != 3) {
+
+        cerr << "Missing or unexpected arguments" << endl;
+        showUsage(argv[0]);
+        return 1;
+    }
+    const string &host = positionals[0];
+    const string &port = positionals[1];
+
+    // Read the operation mix
+    ifstream mixFile(positionals[2]);
+    if (!mixFile) {
+        cerr << "Unable to open " << positionals[2] << endl;
+        return 1;
+    }
+    vector<Operation> operations;
+    bool bPlatformNeeded = false;
+    string line;
+
+    while (getline(mixFile, line)) {
+
+        if (line.find_first_not_of(" \t") == string::npos || line[0] == '#') {
+            continue;
+        }
+        Operation operation;
+        string strError;
+
+        if (!parseOperation(line, operation, strError)) {
+            cerr << strError << endl;
+            return 1;
+        }
+        bPlatformNeeded |= operation.bPlatform;
+        operations.push_back(operation);
+    }
+    if (operations.empty()) {
+        cerr << "No operation in " << positionals[2] << endl;
+        return 1;
+    }
+    if (bPlatformNeeded && platformHost.empty()) {
+        cerr << "Criterion operations need a test-platform, see --platform" << endl;
+        return 1;
+    }
+    if (!bPlatformNeeded) {
+        platformHost.clear();
+    }
+
+    // Connect all the clients before starting
+    vector<unique_ptr<Client>> clients;
+
+    for (size_t client = 0; client < clientCount; client++) {
+
+        clients.emplace_back(new Client(operations, static_cast<unsigned>(client)));
+        try {
+            clients.back()->connect(host, port, platformHost, platformPort);
+        } catch (const asio::system_error &e) {
+            cerr << "Connection of client " << client + 1 << " failed: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    Clock::time_point start = Clock::now();
+    Clock::time_point deadline = start + chrono::seconds(duration);
+    vector<thread> threads;
+
+    for (auto &client : clients) {
+        threads.emplace_back(&Client::run, client.get(), deadline);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    // Aggregate
+    Statistics overall;
+    vector<Statistics> perOperation(operations.size());
+    bool bFailed = false;
+
+    for (const auto &client : clients) {
+
+        if (!client->error().empty()) {
+            cerr << "A client stopped: " << client->error() << endl;
+            bFailed = true;
+        }
+        for (size_t operation = 0; operation < operations.size(); operation++) {
+
+            perOperation[operation].merge(client->statistics()[operation]);
+            overall.merge(client->statistics()[operation]);
+        }
+    }
+
+    // Report
+    cout << "{\n"
+         << "  \"clients\": " << clientCount << ",\n"
+         << "  \"duration_s\": " << seconds << ",\n";
+    writeStatistics(cout, overall, seconds, "  ");
+    cout << ",\n  \"per_operation\": [";
+
+    for (size_t operation = 0; operation < operations.size(); operation++) {
+
+        cout << (operation == 0 ? "\n" : ",\n") << "    {\n"
+             << "      \"name\": " << utility::asJsonString(operations[operation].name) << ",\n";
+        writeStatistics(cout, perOperation[operation], seconds, "      ");
+        cout << "\n    }";
+    }
+    cout << "\n  ]\n}" << endl;
+
+    return bFailed ? 1 : 0;
+}
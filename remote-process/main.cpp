@@ -30,31 +30,98 @@
 
 #include <asio.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
 #include <iostream>
+#include <fstream>
 #include <string>
 #include <cstring>
 #include <stdlib.h>
 #include "RequestMessage.h"
 #include "AnswerMessage.h"
+#include "BatchRequestMessage.h"
+#include "BatchAnswerMessage.h"
+#include "SubscribeRequestMessage.h"
+#include "NotificationMessage.h"
 #include "Socket.h"
+#include "Connect.hpp"
+#include "Tokenizer.h"
+#include "convert.hpp"
 
 using namespace std;
 
-bool sendAndDisplayCommand(asio::ip::tcp::socket &socket, CRequestMessage &requestMessage)
+/** Whether the target decodes compressed messages, as advertised in its answers */
+static bool targetAcceptsCompression = false;
+
+/** Send a request, compressed if large and if the target decodes compressed messages
+ *
+ * Also tell the target that its answers may be compressed.
+ */
+static CMessage::Result send(asio::generic::stream_protocol::socket &socket, CMessage &request,
+                             string &strError)
+{
+    request.advertiseCompression();
+
+    if (targetAcceptsCompression) {
+        request.allowCompression();
+    }
+    return request.serialize(Socket(socket), true, strError);
+}
+
+/** Receive an answer, learning whether the target decodes compressed messages */
+static CMessage::Result receive(asio::generic::stream_protocol::socket &socket,
+                                CMessage &answer, string &strError)
+{
+    // Compression is offered in every request
+    answer.advertiseCompression();
+    CMessage::Result result = answer.serialize(Socket(socket), false, strError);
+
+    if (result == CMessage::success) {
+        targetAcceptsCompression = answer.peerAcceptsCompression();
+    }
+    return result;
+}
+
+/** Receive the answer to a command, displaying its chunks as they arrive
+ *
+ * @param[out] answerMessage the final answer, to be displayed after the chunks
+ *
+ * @return false if the answer could not be received
+ */
+static bool receiveAnswer(asio::generic::stream_protocol::socket &socket,
+                          CAnswerMessage &answerMessage)
+{
+    string strError;
+
+    do {
+        if (receive(socket, answerMessage, strError) != CRequestMessage::success) {
+
+            cerr << "Unable to received answer from target: " << strError << endl;
+            return false;
+        }
+        if (answerMessage.isChunk()) {
+            cout << answerMessage.getAnswer();
+        }
+    } while (answerMessage.isChunk());
+
+    return true;
+}
+
+bool sendAndDisplayCommand(asio::generic::stream_protocol::socket &socket,
+                           CRequestMessage &requestMessage)
 {
     string strError;
 
-    if (requestMessage.serialize(Socket(socket), true, strError) != CRequestMessage::success) {
+    if (send(socket, requestMessage, strError) != CRequestMessage::success) {
 
         cerr << "Unable to send command to target: " << strError << endl;
         return false;
     }
 
-    ///// Get answer
+    ///// Get answer, possibly preceded by chunks
     CAnswerMessage answerMessage;
-    if (answerMessage.serialize(Socket(socket), false, strError) != CRequestMessage::success) {
-
-        cerr << "Unable to received answer from target: " << strError << endl;
+    if (!receiveAnswer(socket, answerMessage)) {
         return false;
     }
 
@@ -72,38 +139,402 @@ bool sendAndDisplayCommand(asio::ip::tcp::socket &socket, CRequestMessage &reque
     return true;
 }
 
+/** Send a batch of commands and display their results
+ *
+ * @param[in,out] answerMessage receives the results, reused from one batch to the other
+ *
+ * @return false if a command failed or could not be sent
+ */
+bool sendAndDisplayBatch(asio::generic::stream_protocol::socket &socket,
+                         CBatchRequestMessage &batchMessage, CBatchAnswerMessage &answerMessage)
+{
+    string strError;
+
+    if (send(socket, batchMessage, strError) != CRequestMessage::success) {
+
+        cerr << "Unable to send commands to target: " << strError << endl;
+        return false;
+    }
+
+    ///// Get answers
+    if (receive(socket, answerMessage, strError) != CRequestMessage::success) {
+
+        cerr << "Unable to received answer from target: " << strError << endl;
+        return false;
+    }
+
+    bool bSuccess = true;
+
+    for (size_t result = 0; result < answerMessage.getResultCount(); result++) {
+
+        if (answerMessage.success(result)) {
+            cout << answerMessage.getAnswer(result) << endl;
+        } else {
+            cerr << answerMessage.getAnswer(result) << endl;
+            bSuccess = false;
+        }
+    }
+
+    // Stopped on error?
+    if (answerMessage.getResultCount() < batchMessage.getCommandCount()) {
+
+        size_t skipped = batchMessage.getCommandCount() - answerMessage.getResultCount();
+        cerr << "Stopped on error, " << skipped << " command(s) not executed" << endl;
+    }
+
+    return bSuccess;
+}
+
+/** Read commands, one per line, and send them by batches
+ *
+ * Empty lines and lines starting with '#' are ignored.
+ *
+ * @return false if a command failed or could not be sent
+ */
+bool sendAndDisplayCommands(asio::generic::stream_protocol::socket &socket, std::istream &input,
+                            size_t batchSize, bool bStopOnError)
+{
+    CBatchRequestMessage batchMessage(bStopOnError);
+    CBatchAnswerMessage answerMessage;
+    bool bSuccess = true;
+    string line;
+    string token;
+
+    while (std::getline(input, line)) {
+
+        Tokenizer tokenizer(line);
+
+        if (!tokenizer.next(token) || token[0] == '#') {
+            continue;
+        }
+
+        IRemoteCommand &command = batchMessage.addCommand(token);
+
+        while (tokenizer.next(token)) {
+            command.addArgument(token);
+        }
+
+        if (batchMessage.getCommandCount() == batchSize) {
+
+            bSuccess &= sendAndDisplayBatch(socket, batchMessage, answerMessage);
+            batchMessage.clear();
+
+            if (!bSuccess && bStopOnError) {
+                return false;
+            }
+        }
+    }
+
+    if (batchMessage.getCommandCount() != 0) {
+
+        bSuccess &= sendAndDisplayBatch(socket, batchMessage, answerMessage);
+    }
+
+    return bSuccess;
+}
+
+using Clock = std::chrono::steady_clock;
+
+/** Latencies of the commands sent on a connection */
+struct LatencyStatistics
+{
+    void add(Clock::duration latency)
+    {
+        count++;
+        total += latency;
+        max = std::max(max, latency);
+    }
+
+    size_t count{0};
+    Clock::duration total{0};
+    Clock::duration max{0};
+};
+
+static long long toMicroseconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+/** Receive the answer of the oldest pending command and display it
+ *
+ * @param[in,out] pending the send time of the commands waiting for their answer
+ * @param[out] bSuccess set to false if the command failed
+ *
+ * @return false if the answer could not be received
+ */
+static bool receiveAndDisplayAnswer(asio::generic::stream_protocol::socket &socket,
+                                    std::deque<Clock::time_point> &pending,
+                                    LatencyStatistics *latencies, bool &bSuccess)
+{
+    CAnswerMessage answerMessage;
+
+    if (!receiveAnswer(socket, answerMessage)) {
+        return false;
+    }
+    Clock::duration latency = Clock::now() - pending.front();
+    pending.pop_front();
+
+    if (answerMessage.success()) {
+        cout << answerMessage.getAnswer() << endl;
+    } else {
+        cerr << answerMessage.getAnswer() << endl;
+        bSuccess = false;
+    }
+
+    if (latencies != nullptr) {
+
+        latencies->add(latency);
+        cerr << "(" << toMicroseconds(latency) << " us)" << endl;
+    }
+    return true;
+}
+
+/** Read commands, one per line, and send them one by one on the same connection
+ *
+ * Each answer is displayed as soon as received. Up to pipelineDepth commands
+ * are sent before waiting for the oldest answer, hiding the round trips.
+ * Empty lines and lines starting with '#' are ignored.
+ *
+ * @param[in] bLatency display the latency of each command, then statistics
+ *
+ * @return false if a command failed or could not be sent
+ */
+bool sendAndDisplayInteractive(asio::generic::stream_protocol::socket &socket,
+                               std::istream &input, size_t pipelineDepth, bool bLatency)
+{
+    std::deque<Clock::time_point> pending;
+    LatencyStatistics latencies;
+    LatencyStatistics *pLatencies = bLatency ? &latencies : nullptr;
+    bool bSuccess = true;
+    string line;
+    string token;
+    string strError;
+
+    while (std::getline(input, line)) {
+
+        Tokenizer tokenizer(line);
+
+        if (!tokenizer.next(token) || token[0] == '#') {
+            continue;
+        }
+
+        CRequestMessage requestMessage(token);
+        requestMessage.acceptChunkedAnswer();
+
+        while (tokenizer.next(token)) {
+            requestMessage.addArgument(token);
+        }
+
+        if (send(socket, requestMessage, strError) != CRequestMessage::success) {
+
+            cerr << "Unable to send command to target: " << strError << endl;
+            return false;
+        }
+        pending.push_back(Clock::now());
+
+        if (pending.size() >= pipelineDepth &&
+            !receiveAndDisplayAnswer(socket, pending, pLatencies, bSuccess)) {
+            return false;
+        }
+    }
+
+    while (!pending.empty()) {
+
+        if (!receiveAndDisplayAnswer(socket, pending, pLatencies, bSuccess)) {
+            return false;
+        }
+    }
+
+    if (bLatency && latencies.count != 0) {
+
+        cerr << latencies.count << " command(s), mean "
+             << toMicroseconds(latencies.total) / static_cast<long long>(latencies.count)
+             << " us, max " << toMicroseconds(latencies.max) << " us" << endl;
+    }
+    return bSuccess;
+}
+
+/** Subscribe to notifications and display them until the target disconnects
+ *
+ * @param[in] subscribeMessage the subscription, with the kinds of events to notify
+ *
+ * @return false if the subscription failed or the connection was lost on error
+ */
+bool subscribeAndDisplayNotifications(asio::generic::stream_protocol::socket &socket,
+                                      CSubscribeRequestMessage &subscribeMessage)
+{
+    string strError;
+
+    if (send(socket, subscribeMessage, strError) != CRequestMessage::success) {
+
+        cerr << "Unable to send subscription to target: " << strError << endl;
+        return false;
+    }
+
+    CAnswerMessage answerMessage;
+    if (receive(socket, answerMessage, strError) != CRequestMessage::success) {
+
+        cerr << "Unable to received answer from target: " << strError << endl;
+        return false;
+    }
+    if (!answerMessage.success()) {
+
+        cerr << answerMessage.getAnswer() << endl;
+        return false;
+    }
+
+    CNotificationMessage notificationMessage;
+
+    while (true) {
+
+        switch (receive(socket, notificationMessage, strError)) {
+        case CRequestMessage::success:
+            break;
+        case CRequestMessage::peerDisconnected:
+            return true;
+        default:
+            cerr << "Unable to receive notification from target: " << strError << endl;
+            return false;
+        }
+
+        if (notificationMessage.getDropped() != 0) {
+            cout << "(" << notificationMessage.getDropped() << " notification(s) dropped)"
+                 << endl;
+        }
+        cout << notificationMessage.getKind() << ": " << notificationMessage.getEvent() << endl;
+    }
+}
+
+static void showUsage(const char *name)
+{
+    cerr << "Usage: " << endl;
+    cerr << "Send a single command:" << endl;
+    cerr << "\t" << name << " hostname port command [argument[s]]" << endl;
+    cerr << "Send commands read from a file (or stdin if none given), one per line:" << endl;
+    cerr << "\t" << name
+         << " hostname port --batch [--stop-on-error] [--batch-size count] [file]" << endl;
+    cerr << "Send commands read from a file (or stdin if none given) on a single connection:"
+         << endl;
+    cerr << "\t" << name << " hostname port --interactive [--pipeline depth] [--latency] [file]"
+         << endl;
+    cerr << "Display events (criterion, configuration, sync) as they happen, all if none given:"
+         << endl;
+    cerr << "\t" << name << " hostname port --subscribe [kind[s]]" << endl;
+    cerr << "In all cases, connect to a Unix domain socket by replacing hostname and port with:"
+         << endl;
+    cerr << "\t--unix socket-path" << endl;
+}
+
+static const size_t defaultBatchSize = 256;
+
 // hostname port command [argument[s]]
 // or
-// hostname port < commands
+// --unix socket-path command [argument[s]]
+// or
+// hostname port --batch [options] [file]
+// or
+// hostname port --batch [options] < commands
+// or
+// hostname port --interactive [options] [file]
+// or
+// hostname port --subscribe [kind[s]]
 int main(int argc, char *argv[])
 {
     // Enough args?
     if (argc < 4) {
 
         cerr << "Missing arguments" << endl;
-        cerr << "Usage: " << endl;
-        cerr << "Send a single command:" << endl;
-        cerr << "\t" << argv[0] << " hostname port command [argument[s]]" << endl;
+        showUsage(argv[0]);
 
         return 1;
     }
-    using asio::ip::tcp;
-    asio::io_service io_service;
-    tcp::resolver resolver(io_service);
 
-    tcp::socket connectionSocket(io_service);
+    // Batch and interactive mode options
+    bool bBatch = string(argv[3]) == "--batch";
+    bool bInteractive = string(argv[3]) == "--interactive";
+    bool bStopOnError = false;
+    size_t batchSize = defaultBatchSize;
+    size_t pipelineDepth = 1;
+    bool bLatency = false;
+    string inputFile;
+
+    if (bBatch || bInteractive) {
+
+        for (int arg = 4; arg < argc; arg++) {
+
+            string option(argv[arg]);
+
+            if (bBatch && option == "--stop-on-error") {
+                bStopOnError = true;
+            } else if (bBatch && option == "--batch-size" && arg + 1 < argc) {
+                if (!convertTo(string(argv[++arg]), batchSize) || batchSize == 0) {
+                    cerr << "Invalid batch size: " << argv[arg] << endl;
+                    return 1;
+                }
+            } else if (bInteractive && option == "--pipeline" && arg + 1 < argc) {
+                if (!convertTo(string(argv[++arg]), pipelineDepth) || pipelineDepth == 0) {
+                    cerr << "Invalid pipeline depth: " << argv[arg] << endl;
+                    return 1;
+                }
+            } else if (bInteractive && option == "--latency") {
+                bLatency = true;
+            } else if (inputFile.empty() && option.compare(0, 2, "--") != 0) {
+                inputFile = option;
+            } else {
+                cerr << "Unexpected argument: " << option << endl;
+                showUsage(argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    std::ifstream fileInput;
+    if (!inputFile.empty()) {
+
+        fileInput.open(inputFile);
+        if (!fileInput) {
+            cerr << "Unable to open " << inputFile << endl;
+            return 1;
+        }
+    }
+    asio::io_service io_service;
+    asio::generic::stream_protocol::socket connectionSocket(io_service);
 
     string host{argv[1]};
     string port{argv[2]};
     try {
-        asio::connect(connectionSocket, resolver.resolve(tcp::resolver::query(host, port)));
+        connect(io_service, connectionSocket, host, port);
     } catch (const asio::system_error &e) {
-        cerr << "Connection to '" << host << ":" << port << "' failed: " << e.what() << endl;
+        string peer = host == "--unix" ? port : host + ":" + port;
+        cerr << "Connection to '" << peer << "' failed: " << e.what() << endl;
         return 1;
     }
 
-    // Create command message
+    if (string(argv[3]) == "--subscribe") {
+
+        CSubscribeRequestMessage subscribeMessage;
+
+        for (int arg = 4; arg < argc; arg++) {
+
+            subscribeMessage.addKind(argv[arg]);
+        }
+        return subscribeAndDisplayNotifications(connectionSocket, subscribeMessage) ? 0 : 1;
+    }
+
+    std::istream &input = inputFile.empty() ? std::cin : fileInput;
+
+    if (bBatch) {
+
+        return sendAndDisplayCommands(connectionSocket, input, batchSize, bStopOnError) ? 0 : 1;
+    }
+    if (bInteractive) {
+
+        return sendAndDisplayInteractive(connectionSocket, input, pipelineDepth, bLatency) ? 0 : 1;
+    }
+
+    // Create command message, large answers are displayed as they are received
     CRequestMessage requestMessage(argv[3]);
+    requestMessage.acceptChunkedAnswer();
 
     // Add arguments
     for (int arg = 4; arg < argc; arg++) {
@@ -64,6 +64,11 @@ bool CAnswerMessage::success() const
     return getMsgId() == MsgType::ESuccessAnswer;
 }
 
+bool CAnswerMessage::isChunk() const
+{
+    return getMsgId() == MsgType::EAnswerChunk;
+}
+
 // Size
 size_t CAnswerMessage::getDataSize() const
 {
@@ -79,12 +84,15 @@ void CAnswerMessage::fillDataToSend()
 }
 
 // Collect received data
-void CAnswerMessage::collectReceivedData()
+bool CAnswerMessage::collectReceivedData()
 {
     // Receive answer
     string strAnswer;
 
-    readString(strAnswer);
-
+    if (!readString(strAnswer)) {
+        return false;
+    }
     setAnswer(strAnswer);
+
+    return true;
 }
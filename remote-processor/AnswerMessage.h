@@ -45,11 +45,14 @@ public:
     // Status
     bool success() const;
 
+    /** @return true if this is only a part of the answer, @see CAnswerChunkMessage */
+    bool isChunk() const;
+
 private:
     // Fill data to send
     void fillDataToSend() override;
     // Collect received data
-    void collectReceivedData() override;
+    bool collectReceivedData() override;
 
     /** @return size of the answer message in bytes
     */
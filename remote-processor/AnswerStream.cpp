@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "AnswerStream.h"
+
+CAnswerStream::CAnswerStream(const IRemoteCommand &remoteCommand)
+    : std::ostream(nullptr), _buffer(remoteCommand)
+{
+    rdbuf(&_buffer);
+}
+
+std::string CAnswerStream::str() const
+{
+    return _buffer.pending();
+}
+
+CAnswerStream::Buffer::Buffer(const IRemoteCommand &remoteCommand) : _remoteCommand(remoteCommand)
+{
+}
+
+CAnswerStream::Buffer::int_type CAnswerStream::Buffer::overflow(int_type character)
+{
+    if (!traits_type::eq_int_type(character, traits_type::eof())) {
+
+        _pending += traits_type::to_char_type(character);
+        sendChunk();
+    }
+    return traits_type::not_eof(character);
+}
+
+std::streamsize CAnswerStream::Buffer::xsputn(const char *data, std::streamsize size)
+{
+    _pending.append(data, static_cast<size_t>(size));
+    sendChunk();
+
+    return size;
+}
+
+void CAnswerStream::Buffer::sendChunk()
+{
+    if (!_bChunked || _pending.size() < chunkSize) {
+        return;
+    }
+    if (_remoteCommand.sendAnswerChunk(_pending)) {
+
+        _pending.clear();
+    } else {
+        // Either the client does not accept chunks or the connection is lost, keep all
+        _bChunked = false;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "remote_processor_export.h"
+
+#include "RemoteCommand.h"
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+/** Output stream building the answer of a remote command
+ *
+ * If the client accepts chunked answers, the output is sent as soon as
+ * chunkSize bytes are buffered: large answers are neither held in memory nor
+ * delayed until complete. Otherwise, the whole output is kept, to be sent as
+ * the command result.
+ */
+class REMOTE_PROCESSOR_EXPORT CAnswerStream : public std::ostream
+{
+public:
+    /** Size above which buffered output is sent */
+    static const size_t chunkSize = 64 * 1024;
+
+    /** @param[in] remoteCommand the command being answered */
+    CAnswerStream(const IRemoteCommand &remoteCommand);
+
+    /** @return the output not sent yet, to be sent as the command result */
+    std::string str() const;
+
+private:
+    class Buffer : public std::streambuf
+    {
+    public:
+        Buffer(const IRemoteCommand &remoteCommand);
+
+        const std::string &pending() const { return _pending; }
+
+    private:
+        int_type overflow(int_type character) override;
+        std::streamsize xsputn(const char *data, std::streamsize size) override;
+
+        /** Send the pending output if large enough and if the client accepts chunks */
+        void sendChunk();
+
+        const IRemoteCommand &_remoteCommand;
+        std::string _pending;
+        bool _bChunked{true};
+    };
+
+    Buffer _buffer;
+};
@@ -31,8 +31,10 @@
 #include "RemoteProcessorServer.h"
 
 BackgroundRemoteProcessorServer::BackgroundRemoteProcessorServer(
-    uint16_t uiPort, std::unique_ptr<IRemoteCommandHandler> &&commandHandler)
-    : _server(new CRemoteProcessorServer(uiPort)), mCommandHandler(std::move(commandHandler))
+    uint16_t uiPort, const std::string &socketPath,
+    std::unique_ptr<IRemoteCommandHandler> &&commandHandler, size_t maxClients)
+    : _server(new CRemoteProcessorServer(uiPort, socketPath, maxClients)),
+      mCommandHandler(std::move(commandHandler))
 {
 }
 
@@ -58,6 +60,17 @@ bool BackgroundRemoteProcessorServer::stop()
     return mServerSuccess.get();
 }
 
+bool BackgroundRemoteProcessorServer::hasSubscribers() const
+{
+    return _server->hasSubscribers();
+}
+
+void BackgroundRemoteProcessorServer::notify(const std::string &strKind,
+                                             const std::string &strEvent)
+{
+    _server->notify(strKind, strEvent);
+}
+
 BackgroundRemoteProcessorServer::~BackgroundRemoteProcessorServer()
 {
     stop();
@@ -40,8 +40,15 @@ class REMOTE_PROCESSOR_EXPORT BackgroundRemoteProcessorServer final
     : public IRemoteProcessorServerInterface
 {
 public:
-    BackgroundRemoteProcessorServer(uint16_t uiPort,
-                                    std::unique_ptr<IRemoteCommandHandler> &&commandHandler);
+    /**
+     * @param[in] uiPort the TCP port to listen on, 0 not to listen on TCP.
+     * @param[in] socketPath the Unix domain socket to listen on, empty not to.
+     * @param[in] commandHandler the handler of the commands received by the server.
+     * @param[in] maxClients the maximum number of clients served at the same time.
+     */
+    BackgroundRemoteProcessorServer(uint16_t uiPort, const std::string &socketPath,
+                                    std::unique_ptr<IRemoteCommandHandler> &&commandHandler,
+                                    size_t maxClients);
 
     ~BackgroundRemoteProcessorServer() override;
 
@@ -49,6 +56,10 @@ public:
 
     bool stop() override;
 
+    bool hasSubscribers() const override;
+
+    void notify(const std::string &strKind, const std::string &strEvent) override;
+
 private:
     std::unique_ptr<CRemoteProcessorServer> _server;
     std::unique_ptr<IRemoteCommandHandler> mCommandHandler;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BatchAnswerMessage.h"
+#include <assert.h>
+
+#define base CMessage
+
+using std::string;
+
+CBatchAnswerMessage::CBatchAnswerMessage() : base(MsgType::EBatchAnswer)
+{
+}
+
+void CBatchAnswerMessage::addResult(bool bSuccess, const string &strAnswer)
+{
+    _results.push_back({bSuccess, strAnswer});
+}
+
+size_t CBatchAnswerMessage::getResultCount() const
+{
+    return _results.size();
+}
+
+// Answer
+const string &CBatchAnswerMessage::getAnswer(size_t result) const
+{
+    assert(result < _results.size());
+
+    return _results[result].answer;
+}
+
+// Status
+bool CBatchAnswerMessage::success(size_t result) const
+{
+    assert(result < _results.size());
+
+    return _results[result].success;
+}
+
+// Fill data to send
+void CBatchAnswerMessage::fillDataToSend()
+{
+    uint32_t uiResultCount = static_cast<uint32_t>(_results.size());
+    writeData(&uiResultCount, sizeof(uiResultCount));
+
+    for (const auto &result : _results) {
+
+        uint8_t ucSuccess = result.success;
+        writeData(&ucSuccess, sizeof(ucSuccess));
+
+        writeString(result.answer);
+    }
+}
+
+// Collect received data
+bool CBatchAnswerMessage::collectReceivedData()
+{
+    uint32_t uiResultCount;
+    if (!readData(&uiResultCount, sizeof(uiResultCount))) {
+        return false;
+    }
+
+    _results.clear();
+
+    // Each read is checked, so that a forged count can not make us read past the data
+    for (uint32_t uiResult = 0; uiResult < uiResultCount; uiResult++) {
+
+        uint8_t ucSuccess;
+        string strAnswer;
+
+        if (!readData(&ucSuccess, sizeof(ucSuccess)) || !readString(strAnswer)) {
+            return false;
+        }
+        addResult(ucSuccess != 0, strAnswer);
+    }
+    return true;
+}
+
+// Size
+size_t CBatchAnswerMessage::getDataSize() const
+{
+    // Result count
+    size_t uiSize = sizeof(uint32_t);
+
+    for (const auto &result : _results) {
+
+        uiSize += sizeof(uint8_t) + getStringSize(result.answer);
+    }
+    return uiSize;
+}
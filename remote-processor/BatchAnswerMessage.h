@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "remote_processor_export.h"
+
+#include "Message.h"
+#include <vector>
+#include <string>
+
+/** Results of the commands of a CBatchRequestMessage, in order
+ *
+ * When the batch is stopped on error, there are less results than commands.
+ */
+class REMOTE_PROCESSOR_EXPORT CBatchAnswerMessage : public CMessage
+{
+public:
+    CBatchAnswerMessage();
+
+    /** Append the result of a command */
+    void addResult(bool bSuccess, const std::string &strAnswer);
+
+    size_t getResultCount() const;
+
+    // Answer
+    const std::string &getAnswer(size_t result) const;
+
+    // Status
+    bool success(size_t result) const;
+
+private:
+    // Fill data to send
+    void fillDataToSend() override;
+    // Collect received data
+    bool collectReceivedData() override;
+
+    /** @return size of the batch answer message in bytes
+    */
+    size_t getDataSize() const override;
+
+    struct Result
+    {
+        bool success;
+        std::string answer;
+    };
+    std::vector<Result> _results;
+};
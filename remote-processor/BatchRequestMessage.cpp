@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BatchRequestMessage.h"
+#include <assert.h>
+
+#define base CMessage
+
+using std::string;
+
+CBatchRequestMessage::CBatchRequestMessage(bool bStopOnError)
+    : base(MsgType::EBatchRequest), _bStopOnError(bStopOnError)
+{
+}
+
+CBatchRequestMessage::CBatchRequestMessage() : CBatchRequestMessage(false)
+{
+}
+
+IRemoteCommand &CBatchRequestMessage::addCommand(const string &strCommand)
+{
+    _commands.emplace_back(new CRequestMessage);
+    _commands.back()->setCommand(strCommand);
+
+    return *_commands.back();
+}
+
+size_t CBatchRequestMessage::getCommandCount() const
+{
+    return _commands.size();
+}
+
+const IRemoteCommand &CBatchRequestMessage::getCommand(size_t command) const
+{
+    assert(command < _commands.size());
+
+    return *_commands[command];
+}
+
+bool CBatchRequestMessage::stopOnError() const
+{
+    return _bStopOnError;
+}
+
+void CBatchRequestMessage::clear()
+{
+    _commands.clear();
+}
+
+// Fill data to send
+void CBatchRequestMessage::fillDataToSend()
+{
+    uint8_t ucStopOnError = _bStopOnError;
+    writeData(&ucStopOnError, sizeof(ucStopOnError));
+
+    uint32_t uiCommandCount = static_cast<uint32_t>(_commands.size());
+    writeData(&uiCommandCount, sizeof(uiCommandCount));
+
+    for (const auto &command : _commands) {
+
+        uint32_t uiArgumentCount = static_cast<uint32_t>(command->getArgumentCount());
+        writeData(&uiArgumentCount, sizeof(uiArgumentCount));
+
+        writeString(command->getCommand());
+
+        for (const auto &argument : command->getArguments()) {
+
+            writeString(argument);
+        }
+    }
+}
+
+// Collect received data
+bool CBatchRequestMessage::collectReceivedData()
+{
+    uint8_t ucStopOnError;
+    uint32_t uiCommandCount;
+
+    if (!readData(&ucStopOnError, sizeof(ucStopOnError)) ||
+        !readData(&uiCommandCount, sizeof(uiCommandCount))) {
+        return false;
+    }
+    _bStopOnError = ucStopOnError != 0;
+
+    _commands.clear();
+
+    // Each read is checked, so that forged counts can not make us read past the data
+    for (uint32_t uiCommand = 0; uiCommand < uiCommandCount; uiCommand++) {
+
+        uint32_t uiArgumentCount;
+        string strCommand;
+
+        if (!readData(&uiArgumentCount, sizeof(uiArgumentCount)) || !readString(strCommand)) {
+            return false;
+        }
+        IRemoteCommand &command = addCommand(strCommand);
+
+        for (uint32_t uiArgument = 0; uiArgument < uiArgumentCount; uiArgument++) {
+
+            string strArgument;
+            if (!readString(strArgument)) {
+                return false;
+            }
+            command.addArgument(strArgument);
+        }
+    }
+    return true;
+}
+
+// Size
+size_t CBatchRequestMessage::getDataSize() const
+{
+    // Stop on error flag and command count
+    size_t uiSize = sizeof(uint8_t) + sizeof(uint32_t);
+
+    for (const auto &command : _commands) {
+
+        // Argument count and command name
+        uiSize += sizeof(uint32_t) + getStringSize(command->getCommand());
+
+        for (const auto &argument : command->getArguments()) {
+
+            uiSize += getStringSize(argument);
+        }
+    }
+    return uiSize;
+}
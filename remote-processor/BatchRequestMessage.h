@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "remote_processor_export.h"
+
+#include "Message.h"
+#include "RequestMessage.h"
+#include <memory>
+#include <vector>
+#include <string>
+
+/** Several commands sent in a single message
+ *
+ * The server processes the commands in order and sends back their results in
+ * a single CBatchAnswerMessage, saving a round trip per command.
+ */
+class REMOTE_PROCESSOR_EXPORT CBatchRequestMessage : public CMessage
+{
+public:
+    /** @param[in] bStopOnError if true, the commands following a failed one are not processed */
+    CBatchRequestMessage(bool bStopOnError);
+    CBatchRequestMessage();
+
+    /** Append a command to the batch
+     *
+     * @param[in] strCommand the command name
+     *
+     * @return the command, to which arguments may be added
+     */
+    IRemoteCommand &addCommand(const std::string &strCommand);
+
+    size_t getCommandCount() const;
+    const IRemoteCommand &getCommand(size_t command) const;
+
+    bool stopOnError() const;
+
+    /** Remove all commands, so that the message can be reused for another batch */
+    void clear();
+
+private:
+    // Fill data to send
+    void fillDataToSend() override;
+    // Collect received data
+    bool collectReceivedData() override;
+
+    /** @return size of the batch message in bytes
+    */
+    size_t getDataSize() const override;
+
+    bool _bStopOnError;
+
+    // Commands
+    std::vector<std::unique_ptr<CRequestMessage>> _commands;
+};
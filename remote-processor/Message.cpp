@@ -31,9 +31,13 @@
 #include "Socket.h"
 #include "Iterator.hpp"
 #include <asio.hpp>
+#include <zlib.h>
 #include <vector>
 #include <numeric>
 #include <cassert>
+#include <array>
+#include <cstring>
+#include <string>
 
 using std::string;
 
@@ -51,6 +55,26 @@ CMessage::MsgType CMessage::getMsgId() const
     return _ucMsgId;
 }
 
+void CMessage::setMsgId(MsgType msgId)
+{
+    _ucMsgId = msgId;
+}
+
+void CMessage::advertiseCompression()
+{
+    _bAdvertiseCompression = true;
+}
+
+void CMessage::allowCompression()
+{
+    _bCompressionAllowed = true;
+}
+
+bool CMessage::peerAcceptsCompression() const
+{
+    return (_flags & acceptsCompressionFlag) != 0;
+}
+
 bool CMessage::isValidAccess(size_t offset, size_t size) const
 {
     return offset + size <= getMessageDataSize();
@@ -70,9 +94,11 @@ void CMessage::writeData(const void *pvData, size_t size)
     _uiIndex += size;
 }
 
-void CMessage::readData(void *pvData, size_t size)
+bool CMessage::readData(void *pvData, size_t size)
 {
-    assert(isValidAccess(_uiIndex, size));
+    if (!isValidAccess(_uiIndex, size)) {
+        return false;
+    }
 
     auto first = begin(mData) + _uiIndex;
     auto last = first + size;
@@ -81,6 +107,8 @@ void CMessage::readData(void *pvData, size_t size)
     std::copy(first, last, destFirst);
 
     _uiIndex += size;
+
+    return true;
 }
 
 void CMessage::writeString(const string &strData)
@@ -94,24 +122,21 @@ void CMessage::writeString(const string &strData)
     writeData(strData.c_str(), size);
 }
 
-void CMessage::readString(string &strData)
+bool CMessage::readString(string &strData)
 {
     // Size
     uint32_t uiSize;
 
-    readData(&uiSize, sizeof(uiSize));
+    if (!readData(&uiSize, sizeof(uiSize)) || !isValidAccess(_uiIndex, uiSize)) {
+        return false;
+    }
 
-    // Data
-    std::vector<char> string(uiSize + 1);
+    // Content, which may be binary
+    strData.assign(reinterpret_cast<const char *>(mData.data() + _uiIndex), uiSize);
 
-    // Content
-    readData(string.data(), uiSize);
+    _uiIndex += uiSize;
 
-    // NULL-terminate string
-    string.back() = '\0';
-
-    // Output
-    strData = string.data();
+    return true;
 }
 
 size_t CMessage::getStringSize(const string &strData) const
@@ -129,133 +154,263 @@ size_t CMessage::getRemainingDataSize() const
 // Send/Receive
 CMessage::Result CMessage::serialize(Socket &&socket, bool bOut, string &strError)
 {
-    asio::ip::tcp::socket &asioSocket = socket.get();
+    asio::generic::stream_protocol::socket &asioSocket = socket.get();
+    asio::error_code ec;
 
     if (bOut) {
-        asio::error_code ec;
 
-        // Make room for data to send
-        allocateData(getDataSize());
+        // Header and checksum surround the data provided by derived
+        uint8_t header[headerSize];
+        uint8_t ucChecksum = prepareToSend(header);
 
-        // Get data from derived
-        fillDataToSend();
+        // Single gathered write, so that the message is not split in several segments
+        std::array<asio::const_buffer, 3> buffers{{asio::buffer(header), asio::buffer(mData),
+                                                   asio::buffer(&ucChecksum, sizeof(ucChecksum))}};
 
-        // Finished providing data?
-        assert(_uiIndex == getMessageDataSize());
+        if (!asio::write(asioSocket, buffers, ec)) {
 
-        // First send sync word
-        uint16_t uiSyncWord = SYNC_WORD;
+            if (ec == asio::error::eof) {
+                return peerDisconnected;
+            }
+            strError = string("Message write failed: ") + ec.message();
+            return error;
+        }
 
-        if (!asio::write(asioSocket, asio::buffer(&uiSyncWord, sizeof(uiSyncWord)), ec)) {
+    } else {
+        // First read sync word, size and msg id
+        uint8_t header[headerSize];
 
+        if (!asio::read(asioSocket, asio::buffer(header), ec)) {
+            strError = string("Header read failed: ") + ec.message();
             if (ec == asio::error::eof) {
                 return peerDisconnected;
             }
             return error;
         }
 
-        // Size
-        uint32_t uiSize = (uint32_t)(sizeof(_ucMsgId) + getMessageDataSize());
+        MsgType msgId;
+        uint8_t flags;
+        size_t remainingSize;
 
-        if (!asio::write(asioSocket, asio::buffer(&uiSize, sizeof(uiSize)), ec)) {
-
-            strError += string("Size write failed: ") + ec.message();
+        if (!decodeHeader(header, msgId, flags, remainingSize, strError)) {
             return error;
         }
+        _ucMsgId = msgId;
+        _flags = flags;
+
+        // Then data and checksum, data being read in place
+        allocateData(remainingSize - sizeof(uint8_t));
 
-        // Msg Id
-        if (!asio::write(asioSocket, asio::buffer(&_ucMsgId, sizeof(_ucMsgId)), ec)) {
+        uint8_t ucChecksum = 0;
+        std::array<asio::mutable_buffer, 2> buffers{
+            {asio::buffer(mData), asio::buffer(&ucChecksum, sizeof(ucChecksum))}};
 
-            strError += string("Msg write failed: ") + ec.message();
+        if (!asio::read(asioSocket, buffers, ec)) {
+            strError = string("Data read failed: ") + ec.message();
+            return error;
+        }
+        if (!checkAndDecompress(ucChecksum, strError)) {
             return error;
         }
 
-        // Data
-        if (!asio::write(asioSocket, asio::buffer(mData), ec)) {
-
-            strError = string("Data write failed: ") + ec.message();
+        // Collect data in derived
+        if (!collectReceivedData()) {
+            strError = "Truncated message data";
             return error;
         }
+    }
 
-        // Checksum
-        uint8_t ucChecksum = computeChecksum();
+    return success;
+}
 
-        if (!asio::write(asioSocket, asio::buffer(&ucChecksum, sizeof(ucChecksum)), ec)) {
+uint8_t CMessage::prepareToSend(uint8_t *header)
+{
+    // Make room for data to send
+    allocateData(getDataSize());
 
-            strError = string("Checksum write failed: ") + ec.message();
-            return error;
-        }
+    // Get data from derived
+    fillDataToSend();
 
-    } else {
-        // First read sync word
-        uint16_t uiSyncWord = 0;
-        asio::error_code ec;
+    // Finished providing data?
+    assert(_uiIndex == getMessageDataSize());
 
-        if (!asio::read(asioSocket, asio::buffer(&uiSyncWord, sizeof(uiSyncWord)), ec)) {
-            strError = string("Sync read failed: ") + ec.message();
-            if (ec == asio::error::eof) {
-                return peerDisconnected;
-            }
-            return error;
-        }
+    _flags = _bAdvertiseCompression ? acceptsCompressionFlag : 0;
+    compress();
 
-        // Check Sync word
-        if (uiSyncWord != SYNC_WORD) {
+    uint16_t uiSyncWord = SYNC_WORD;
+    uint32_t uiSize = (uint32_t)(sizeof(_ucMsgId) + getMessageDataSize());
+    uint8_t ucMsgId = static_cast<uint8_t>(_ucMsgId) | _flags;
 
-            strError = "Sync word incorrect";
-            return error;
-        }
+    memcpy(header, &uiSyncWord, sizeof(uiSyncWord));
+    header += sizeof(uiSyncWord);
+    memcpy(header, &uiSize, sizeof(uiSize));
+    header += sizeof(uiSize);
+    memcpy(header, &ucMsgId, sizeof(ucMsgId));
 
-        // Size
-        uint32_t uiSize = 0;
+    // Computed on the data as sent, possibly compressed
+    return computeChecksum();
+}
 
-        if (!asio::read(asioSocket, asio::buffer(&uiSize, sizeof(uiSize)), ec)) {
-            strError = string("Size read failed: ") + ec.message();
-            return error;
-        }
+void CMessage::compress()
+{
+    if (!_bCompressionAllowed || getMessageDataSize() <= compressionThreshold) {
+        return;
+    }
+    // The size of the original data, then the deflated data
+    uint32_t uiSize = static_cast<uint32_t>(getMessageDataSize());
+    uLongf compressedSize = compressBound(uiSize);
+    Data compressed(sizeof(uiSize) + compressedSize);
 
-        // Msg Id
-        if (!asio::read(asioSocket, asio::buffer(&_ucMsgId, sizeof(_ucMsgId)), ec)) {
-            strError = string("Msg id read failed: ") + ec.message();
-            return error;
-        }
+    memcpy(compressed.data(), &uiSize, sizeof(uiSize));
+
+    if (compress2(compressed.data() + sizeof(uiSize), &compressedSize, mData.data(), uiSize,
+                  Z_DEFAULT_COMPRESSION) != Z_OK ||
+        sizeof(uiSize) + compressedSize >= getMessageDataSize()) {
 
-        // Data
+        // Not worth it, send as is
+        return;
+    }
+    compressed.resize(sizeof(uiSize) + compressedSize);
 
-        // Allocate
-        allocateData(uiSize - sizeof(_ucMsgId));
+    mData.swap(compressed);
+    _flags |= compressedFlag;
+}
 
-        // Data receive
-        if (!asio::read(asioSocket, asio::buffer(mData), ec)) {
-            strError = string("Data read failed: ") + ec.message();
-            return error;
-        }
+bool CMessage::checkAndDecompress(uint8_t ucChecksum, string &strError)
+{
+    // Computed on the data as received, possibly compressed
+    if (ucChecksum != computeChecksum()) {
 
-        // Checksum
-        uint8_t ucChecksum = 0;
+        strError = "Received checksum != computed checksum";
+        return false;
+    }
+    if ((_flags & compressedFlag) == 0) {
+        return true;
+    }
+    if (!_bAdvertiseCompression) {
 
-        if (!asio::read(asioSocket, asio::buffer(&ucChecksum, sizeof(ucChecksum)), ec)) {
-            strError = string("Checksum read failed: ") + ec.message();
-            return error;
-        }
-        // Compare
-        if (ucChecksum != computeChecksum()) {
+        strError = "Compressed data from a peer which was not offered compression";
+        return false;
+    }
 
-            strError = "Received checksum != computed checksum";
-            return error;
-        }
+    uint32_t uiSize;
+    if (getMessageDataSize() < sizeof(uiSize)) {
 
-        // Collect data in derived
-        collectReceivedData();
+        strError = "Compressed data too short";
+        return false;
     }
+    memcpy(&uiSize, mData.data(), sizeof(uiSize));
 
-    return success;
+    // The size is sent by the peer, check it before allocating
+    if (uiSize > maxDecompressedSize ||
+        uiSize > (getMessageDataSize() - sizeof(uiSize)) * maxCompressionRatio) {
+
+        strError = "Decompressed size too large: " + std::to_string(uiSize);
+        return false;
+    }
+
+    Data decompressed(uiSize);
+    uLongf decompressedSize = uiSize;
+
+    if (uncompress(decompressed.data(), &decompressedSize, mData.data() + sizeof(uiSize),
+                   getMessageDataSize() - sizeof(uiSize)) != Z_OK ||
+        decompressedSize != uiSize) {
+
+        strError = "Unable to decompress data";
+        return false;
+    }
+    mData.swap(decompressed);
+
+    return true;
+}
+
+void CMessage::encode(std::vector<uint8_t> &frame)
+{
+    uint8_t header[headerSize];
+    uint8_t ucChecksum = prepareToSend(header);
+
+    frame.resize(headerSize + getMessageDataSize() + sizeof(ucChecksum));
+
+    auto dest = std::copy(std::begin(header), std::end(header), begin(frame));
+    dest = std::copy(begin(mData), end(mData), dest);
+    *dest = ucChecksum;
+}
+
+bool CMessage::decodeHeader(const uint8_t *header, MsgType &msgId, uint8_t &flags,
+                            size_t &remainingSize, string &strError)
+{
+    uint16_t uiSyncWord;
+    uint32_t uiSize;
+    uint8_t ucMsgId;
+
+    memcpy(&uiSyncWord, header, sizeof(uiSyncWord));
+    header += sizeof(uiSyncWord);
+    memcpy(&uiSize, header, sizeof(uiSize));
+    header += sizeof(uiSize);
+    memcpy(&ucMsgId, header, sizeof(ucMsgId));
+
+    // The invalid id has all flags set, do not mistake it for a valid one
+    flags = ucMsgId == static_cast<uint8_t>(MsgType::EInvalid)
+                ? 0
+                : static_cast<uint8_t>(ucMsgId & (compressedFlag | acceptsCompressionFlag));
+    msgId = static_cast<MsgType>(ucMsgId & ~flags);
+
+    // Check Sync word
+    if (uiSyncWord != SYNC_WORD) {
+
+        strError = "Sync word incorrect";
+        return false;
+    }
+    // The size accounts for the message id
+    if (uiSize < sizeof(msgId)) {
+
+        strError = "Size incorrect";
+        return false;
+    }
+    // Do not let a peer have the whole frame allocated before reading any of it
+    if (uiSize > maxDecompressedSize) {
+
+        strError = "Frame size too large: " + std::to_string(uiSize);
+        return false;
+    }
+    // Data followed by the checksum
+    remainingSize = uiSize - sizeof(msgId) + sizeof(uint8_t);
+
+    return true;
+}
+
+bool CMessage::decodePayload(MsgType msgId, uint8_t flags, const uint8_t *payload, size_t size,
+                             string &strError)
+{
+    assert(size >= sizeof(uint8_t));
+
+    _ucMsgId = msgId;
+    _flags = flags;
+
+    // Data
+    size_t dataSize = size - sizeof(uint8_t);
+
+    allocateData(dataSize);
+    std::copy(payload, payload + dataSize, begin(mData));
+
+    if (!checkAndDecompress(payload[dataSize], strError)) {
+        return false;
+    }
+
+    // Collect data in derived
+    if (!collectReceivedData()) {
+
+        strError = "Truncated message data";
+        return false;
+    }
+    return true;
 }
 
 // Checksum
 uint8_t CMessage::computeChecksum() const
 {
-    return accumulate(begin(mData), end(mData), static_cast<uint8_t>(_ucMsgId));
+    return accumulate(begin(mData), end(mData),
+                      static_cast<uint8_t>(static_cast<uint8_t>(_ucMsgId) | _flags));
 }
 
 // Allocation of room to store the message
@@ -46,6 +46,13 @@ public:
         ECommandRequest,
         ESuccessAnswer,
         EFailureAnswer,
+        EBatchRequest,
+        EBatchAnswer,
+        EBinaryCommandRequest,
+        ESubscribeRequest,
+        ENotification,
+        EChunkedCommandRequest,
+        EAnswerChunk,
         EInvalid = static_cast<uint8_t>(-1),
     };
     CMessage(MsgType ucMsgId);
@@ -73,9 +80,84 @@ public:
      */
     Result serialize(Socket &&socket, bool bOut, std::string &strError);
 
+    /** Size in bytes of a frame header: sync word, size and message id */
+    static const size_t headerSize = sizeof(uint16_t) + sizeof(uint32_t) + sizeof(MsgType);
+
+    /** Flags sent along the message id, in its upper bits */
+    enum Flags : uint8_t
+    {
+        /** The data is compressed */
+        compressedFlag = 0x80,
+        /** The sender decodes compressed messages */
+        acceptsCompressionFlag = 0x40,
+    };
+
+    /** Data larger than this, in bytes, is compressed when allowed */
+    static const size_t compressionThreshold = 4096;
+
+    /** Frames, or compressed data, announcing a larger size, in bytes, are rejected */
+    static const size_t maxDecompressedSize = 64 * 1024 * 1024;
+
+    /** Maximum compression ratio of deflate, compressed data announcing more is forged */
+    static const size_t maxCompressionRatio = 1032;
+
+    /** Tell the peer that compressed messages can be decoded
+     *
+     * Peers not supporting compression ignore it.
+     * Must also be called before receiving a message from a peer which was told so:
+     * compressed data from a peer which was never offered compression is rejected.
+     */
+    void advertiseCompression();
+
+    /** Compress the data of the message if larger than compressionThreshold
+     *
+     * Only to be called if the peer decodes compressed messages, @see
+     * peerAcceptsCompression.
+     */
+    void allowCompression();
+
+    /** @return true if the sender of the received message decodes compressed messages */
+    bool peerAcceptsCompression() const;
+
+    /** Build the complete frame of the message (header, data and checksum)
+     *
+     * Used by asynchronous writers which need the whole frame in one buffer.
+     *
+     * @param[out] frame the buffer to fill, its previous content is discarded
+     *                   but its capacity is reused.
+     */
+    void encode(std::vector<uint8_t> &frame);
+
+    /** Decode a frame header received by an asynchronous reader
+     *
+     * @param[in] header headerSize bytes of received header.
+     * @param[out] msgId the id of the message, telling how to decode its payload.
+     * @param[out] flags the flags sent along the message id, @see Flags.
+     * @param[out] remainingSize the number of bytes (data and checksum) following the header.
+     * @param[out] strError on failure, a string explaining the error.
+     *
+     * @return true if the header is valid, false otherwise.
+     */
+    static bool decodeHeader(const uint8_t *header, MsgType &msgId, uint8_t &flags,
+                             size_t &remainingSize, std::string &strError);
+
+    /** Decode the rest of the frame: data and checksum
+     *
+     * @param[in] msgId the message id, as returned by decodeHeader.
+     * @param[in] flags the flags, as returned by decodeHeader.
+     * @param[in] payload the bytes following the header.
+     * @param[in] size the payload size as returned by decodeHeader.
+     * @param[out] strError on failure, a string explaining the error.
+     *
+     * @return true if the message could be decoded, false otherwise.
+     */
+    bool decodePayload(MsgType msgId, uint8_t flags, const uint8_t *payload, size_t size,
+                       std::string &strError);
+
 protected:
     // Msg Id
     MsgType getMsgId() const;
+    void setMsgId(MsgType msgId);
 
     /** Write raw data to the message
     *
@@ -88,8 +170,10 @@ protected:
     *
     * @param[out] pvData pointer to the data array
     * @param[in] uiSize array size in bytes
+    *
+    * @return false if less data remains, in which case nothing is read
     */
-    void readData(void *pvData, size_t uiSize);
+    bool readData(void *pvData, size_t uiSize);
 
     /** Write string to the message
     *
@@ -97,11 +181,13 @@ protected:
     */
     void writeString(const std::string &strData);
 
-    /** Write string to the message
+    /** Read string from the message
     *
     * @param[out] strData the string to read to
+    *
+    * @return false if the string is truncated
     */
-    void readString(std::string &strData);
+    bool readString(std::string &strData);
 
     /** @return string length plus room to store its length
     *
@@ -117,6 +203,26 @@ protected:
 private:
     bool isValidAccess(size_t offset, size_t size) const;
 
+    /** Fill data to send and the frame header
+     *
+     * @param[out] header headerSize bytes where to write the header.
+     *
+     * @return the checksum to send after the data.
+     */
+    uint8_t prepareToSend(uint8_t *header);
+
+    /** Replace the data by its compressed form, if allowed and worth it */
+    void compress();
+
+    /** Check the checksum of the received data then decompress it if needed
+     *
+     * @param[in] ucChecksum the received checksum.
+     * @param[out] strError on failure, a string explaining the error.
+     *
+     * @return true if the data is valid and ready to be collected, false otherwise.
+     */
+    bool checkAndDecompress(uint8_t ucChecksum, std::string &strError);
+
     /** Allocate room to store the message
     *
     * @param[int] uiDataSize the szie to allocate in bytes
@@ -124,8 +230,13 @@ private:
     void allocateData(size_t uiDataSize);
     // Fill data to send
     virtual void fillDataToSend() = 0;
-    // Collect received data
-    virtual void collectReceivedData() = 0;
+    /** Collect received data
+     *
+     * The data comes from the peer: it must not be trusted to be complete.
+     *
+     * @return false if the data is truncated
+     */
+    virtual bool collectReceivedData() = 0;
 
     /** @return size of the transaction data in bytes
     */
@@ -137,6 +248,11 @@ private:
     // MsgId
     MsgType _ucMsgId;
 
+    /** Flags of the frame sent or received, @see Flags */
+    uint8_t _flags{0};
+    bool _bAdvertiseCompression{false};
+    bool _bCompressionAllowed{false};
+
     size_t getMessageDataSize() const { return mData.size(); }
 
     using Data = std::vector<uint8_t>;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "NotificationMessage.h"
+
+#define base CMessage
+
+using std::string;
+
+CNotificationMessage::CNotificationMessage(const string &strKind, const string &strEvent,
+                                           uint32_t dropped)
+    : base(MsgType::ENotification), _strKind(strKind), _strEvent(strEvent), _dropped(dropped)
+{
+}
+
+CNotificationMessage::CNotificationMessage() : CNotificationMessage("", "", 0)
+{
+}
+
+const string &CNotificationMessage::getKind() const
+{
+    return _strKind;
+}
+
+const string &CNotificationMessage::getEvent() const
+{
+    return _strEvent;
+}
+
+uint32_t CNotificationMessage::getDropped() const
+{
+    return _dropped;
+}
+
+// Fill data to send
+void CNotificationMessage::fillDataToSend()
+{
+    writeData(&_dropped, sizeof(_dropped));
+    writeString(_strKind);
+    writeString(_strEvent);
+}
+
+// Collect received data
+bool CNotificationMessage::collectReceivedData()
+{
+    return readData(&_dropped, sizeof(_dropped)) && readString(_strKind) &&
+           readString(_strEvent);
+}
+
+// Size
+size_t CNotificationMessage::getDataSize() const
+{
+    return sizeof(_dropped) + getStringSize(_strKind) + getStringSize(_strEvent);
+}
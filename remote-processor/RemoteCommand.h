@@ -50,6 +50,15 @@ public:
     virtual const std::vector<std::string> &getArguments() const = 0;
     virtual std::string packArguments(size_t startArgument, size_t nbArguments) const = 0;
 
+    /** Send a part of the answer right away, before the command completes
+     *
+     * @param[in] strChunk the beginning of the answer, or what follows the previous chunk
+     *
+     * @return false if the client does not accept chunked answers or if the chunk could not
+     *         be sent, in which case it must be kept in the command result.
+     */
+    virtual bool sendAnswerChunk(const std::string &strChunk) const = 0;
+
 protected:
     virtual ~IRemoteCommand() {}
 };
@@ -30,23 +30,439 @@
 #include "RemoteProcessorServer.h"
 #include <iostream>
 #include <memory>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <vector>
 #include <assert.h>
+#include <poll.h>
 #include <string.h>
+#include <unistd.h>
 #include "RequestMessage.h"
 #include "AnswerMessage.h"
+#include "AnswerChunkMessage.h"
+#include "BatchRequestMessage.h"
+#include "BatchAnswerMessage.h"
+#include "SubscribeRequestMessage.h"
+#include "NotificationMessage.h"
 #include "RemoteCommandHandler.h"
-#include "Socket.h"
 
 using std::string;
+using Clock = std::chrono::steady_clock;
 
-CRemoteProcessorServer::CRemoteProcessorServer(uint16_t uiPort)
-    : _uiPort(uiPort), _io_service(), _acceptor(_io_service), _socket(_io_service)
+/** Time given to a client to read the chunks of an answer before giving it up */
+static const std::chrono::milliseconds chunkedAnswerTimeout(10000);
+
+class CRemoteProcessorServer::Session : public std::enable_shared_from_this<Session>
+{
+public:
+    Session(CRemoteProcessorServer &server, IRemoteCommandHandler &commandHandler)
+        : _server(server), _commandHandler(commandHandler), _socket(server._io_service)
+    {
+    }
+
+    /** Either a TCP or a Unix domain socket */
+    asio::generic::stream_protocol::socket &socket() { return _socket; }
+
+    /** Serve the client until it disconnects */
+    void start()
+    {
+        _server._clientCount++;
+
+        // Only meaningful for TCP, fails harmlessly on Unix domain sockets
+        asio::error_code ec;
+        _socket.set_option(asio::ip::tcp::no_delay(true), ec);
+
+        readHeader();
+    }
+
+    /** Close a connection which has not been started */
+    void reject()
+    {
+        asio::error_code ec;
+        _socket.close(ec);
+    }
+
+    /** Queue a notification for a subscribed client, called with the subscription lock held
+     *
+     * When the queue is full, the notification is dropped and counted.
+     */
+    void queueNotification(const string &strKind, const string &strEvent)
+    {
+        if (!_kinds.empty() && std::find(_kinds.begin(), _kinds.end(), strKind) == _kinds.end()) {
+            return;
+        }
+        if (_notifications.size() >= maxPendingNotifications) {
+            _dropped++;
+            return;
+        }
+        _notifications.push_back({strKind, strEvent});
+
+        // Write from the io_service thread, unless already writing
+        if (!_bWriting) {
+            _bWriting = true;
+
+            auto self = shared_from_this();
+            _server._io_service.post([self] { self->writeNotification(); });
+        }
+    }
+
+private:
+    void readHeader()
+    {
+        auto self = shared_from_this();
+
+        asio::async_read(_socket, asio::buffer(_header),
+                         [self](const asio::error_code &ec, size_t) {
+                             if (ec) {
+                                 // Consider peer disconnection as normal, no log
+                                 if (ec != asio::error::eof) {
+                                     self->end("Error while receiving message: " + ec.message());
+                                     return;
+                                 }
+                                 self->end();
+                                 return;
+                             }
+                             self->readPayload();
+                         });
+    }
+
+    void readPayload()
+    {
+        string strError;
+        size_t remainingSize;
+
+        if (!CMessage::decodeHeader(_header.data(), _msgId, _flags, remainingSize, strError)) {
+            end("Error while receiving message: " + strError);
+            return;
+        }
+        // Buffer is reused from one request to the other
+        _payload.resize(remainingSize);
+
+        auto self = shared_from_this();
+
+        asio::async_read(_socket, asio::buffer(_payload),
+                         [self](const asio::error_code &ec, size_t) {
+                             if (ec) {
+                                 self->end("Error while receiving message: " + ec.message());
+                                 return;
+                             }
+                             self->processRequest();
+                         });
+    }
+
+    void processRequest()
+    {
+        if (_bSubscribed) {
+            end("Unexpected request on a connection subscribed to notifications");
+            return;
+        }
+
+        switch (_msgId) {
+        case CMessage::MsgType::EBatchRequest:
+            processBatch();
+            break;
+        case CMessage::MsgType::ESubscribeRequest:
+            processSubscription();
+            break;
+        default:
+            processCommand();
+            break;
+        }
+    }
+
+    void processCommand()
+    {
+        // Create command message
+        CRequestMessage requestMessage;
+
+        if (!decode(requestMessage)) {
+            return;
+        }
+
+        if (_msgId == CMessage::MsgType::EChunkedCommandRequest) {
+
+            // The whole answer is bounded, not each chunk, else a client reading slowly
+            // enough could hold the command lock forever
+            auto deadline = Clock::now() + chunkedAnswerTimeout;
+            requestMessage.setAnswerChunkSender([this, deadline](const string &strChunk) {
+                return writeChunk(strChunk, deadline);
+            });
+        }
+
+        // Actually process the request
+        string strResult;
+        bool bSuccess = _server.processCommand(_commandHandler, requestMessage, strResult);
+
+        // Send back answer
+        CAnswerMessage answerMessage(strResult, bSuccess);
+        writeAnswer(answerMessage);
+    }
+
+    void processBatch()
+    {
+        CBatchRequestMessage batchMessage;
+
+        if (!decode(batchMessage)) {
+            return;
+        }
+
+        // Other sessions may interleave their commands between the batch ones
+        CBatchAnswerMessage answerMessage;
+
+        for (size_t command = 0; command < batchMessage.getCommandCount(); command++) {
+
+            string strResult;
+            bool bSuccess = _server.processCommand(_commandHandler,
+                                                   batchMessage.getCommand(command), strResult);
+
+            answerMessage.addResult(bSuccess, strResult);
+
+            if (!bSuccess && batchMessage.stopOnError()) {
+                break;
+            }
+        }
+        writeAnswer(answerMessage);
+    }
+
+    void processSubscription()
+    {
+        CSubscribeRequestMessage subscribeMessage;
+
+        if (!decode(subscribeMessage)) {
+            return;
+        }
+        _kinds = subscribeMessage.getKinds();
+
+        // Acknowledge, then only notifications are sent
+        CAnswerMessage answerMessage("Subscribed", true);
+        allowCompression(answerMessage);
+        answerMessage.encode(_answer);
+
+        auto self = shared_from_this();
+
+        asio::async_write(_socket, asio::buffer(_answer),
+                          [self](const asio::error_code &ec, size_t) {
+                              if (ec) {
+                                  self->end("Error while sending answer: " + ec.message());
+                                  return;
+                              }
+                              self->_bSubscribed = true;
+                              self->_server.subscribe(self);
+
+                              // Only to detect the disconnection of the client
+                              self->readHeader();
+                          });
+    }
+
+    void writeNotification()
+    {
+        string strKind;
+        string strEvent;
+        uint32_t dropped;
+        {
+            std::lock_guard<std::mutex> lock(_server._subscriptionMutex);
+
+            if (_notifications.empty() || _bEnded) {
+                _bWriting = false;
+                return;
+            }
+            strKind = std::move(_notifications.front().first);
+            strEvent = std::move(_notifications.front().second);
+            _notifications.pop_front();
+
+            dropped = _dropped;
+            _dropped = 0;
+        }
+
+        CNotificationMessage notificationMessage(strKind, strEvent, dropped);
+        allowCompression(notificationMessage);
+        notificationMessage.encode(_answer);
+
+        auto self = shared_from_this();
+
+        asio::async_write(_socket, asio::buffer(_answer),
+                          [self](const asio::error_code &ec, size_t) {
+                              if (ec) {
+                                  self->end("Error while sending notification: " + ec.message());
+                                  return;
+                              }
+                              self->writeNotification();
+                          });
+    }
+
+    /** Decode the received request, ending the session on failure */
+    bool decode(CMessage &message)
+    {
+        string strError;
+
+        // Compressed requests are only accepted once compression has been offered
+        if (_bCompressionOffered) {
+            message.advertiseCompression();
+        }
+        if (!message.decodePayload(_msgId, _flags, _payload.data(), _payload.size(), strError)) {
+            end("Error while receiving message: " + strError);
+            return false;
+        }
+        _bClientAcceptsCompression = message.peerAcceptsCompression();
+
+        return true;
+    }
+
+    /** Compress the messages to clients which decode them */
+    void allowCompression(CMessage &message)
+    {
+        if (_bClientAcceptsCompression) {
+
+            message.advertiseCompression();
+            message.allowCompression();
+            _bCompressionOffered = true;
+        }
+    }
+
+    /** Send a chunk of the answer of the command being processed
+     *
+     * The command is processed synchronously on the io_service thread, holding the command
+     * lock, so must be the write: no other session is served meanwhile. A client which does
+     * not read its answer would stall the whole server, it is disconnected if the chunk can
+     * not be sent before the deadline of the answer.
+     */
+    bool writeChunk(const string &strChunk, Clock::time_point deadline)
+    {
+        CAnswerChunkMessage chunkMessage(strChunk);
+        allowCompression(chunkMessage);
+        chunkMessage.encode(_answer);
+
+        if (!writeBefore(_answer, deadline)) {
+            end("Client not reading its answer, disconnecting it");
+            return false;
+        }
+        return true;
+    }
+
+    /** Synchronous write which gives up at a deadline
+     *
+     * @return false if the data could not be written in time
+     */
+    bool writeBefore(const std::vector<uint8_t> &data, Clock::time_point deadline)
+    {
+        // Never block in the socket, wait for it to be writable until the deadline instead
+        asio::error_code ec;
+        _socket.non_blocking(true, ec);
+
+        size_t written = 0;
+        while (!ec && written < data.size()) {
+
+            written += _socket.write_some(
+                asio::buffer(data.data() + written, data.size() - written), ec);
+
+            if (ec == asio::error::would_block) {
+
+                auto remaining =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+                pollfd writable{_socket.native_handle(), POLLOUT, 0};
+
+                if (remaining.count() <= 0 ||
+                    ::poll(&writable, 1, static_cast<int>(remaining.count())) <= 0) {
+                    break;
+                }
+                ec.clear();
+            }
+        }
+        asio::error_code blockingError;
+        _socket.non_blocking(false, blockingError);
+
+        return !ec && written == data.size();
+    }
+
+    void writeAnswer(CMessage &answerMessage)
+    {
+        allowCompression(answerMessage);
+        answerMessage.encode(_answer);
+
+        auto self = shared_from_this();
+
+        asio::async_write(_socket, asio::buffer(_answer),
+                          [self](const asio::error_code &ec, size_t) {
+                              // Peer should not disconnect while waiting for an answer
+                              if (ec) {
+                                  self->end("Error while sending answer: " + ec.message());
+                                  return;
+                              }
+                              self->readHeader();
+                          });
+    }
+
+    /** Release the connection, the session dies with its last pending handler
+     *
+     * A subscribed session may have both a read and a write pending, hence
+     * may be ended twice.
+     */
+    void end(const string &strError = "")
+    {
+        if (_bEnded.exchange(true)) {
+            return;
+        }
+        if (!strError.empty()) {
+            std::cout << strError << std::endl;
+        }
+        asio::error_code ec;
+        _socket.close(ec);
+
+        if (_bSubscribed) {
+            _server.unsubscribe(this);
+        }
+        _server._clientCount--;
+    }
+
+    CRemoteProcessorServer &_server;
+    IRemoteCommandHandler &_commandHandler;
+    asio::generic::stream_protocol::socket _socket;
+
+    /** Per connection buffers, reused across messages */
+    std::array<uint8_t, CMessage::headerSize> _header;
+    std::vector<uint8_t> _payload;
+    std::vector<uint8_t> _answer;
+
+    /** Id and flags of the message being received */
+    CMessage::MsgType _msgId{CMessage::MsgType::EInvalid};
+    uint8_t _flags{0};
+
+    /** Whether the client advertised it decodes compressed messages */
+    bool _bClientAcceptsCompression{false};
+    /** Whether the client was told compressed requests are decoded */
+    bool _bCompressionOffered{false};
+
+    std::atomic<bool> _bEnded{false};
+
+    /** Subscription state, the queue is protected by the server subscription lock */
+    bool _bSubscribed{false};
+    std::vector<string> _kinds;
+    std::deque<std::pair<string, string>> _notifications;
+    uint32_t _dropped{0};
+    bool _bWriting{false};
+};
+
+CRemoteProcessorServer::CRemoteProcessorServer(uint16_t uiPort, size_t maxClients)
+    : CRemoteProcessorServer(uiPort, "", maxClients)
+{
+}
+
+CRemoteProcessorServer::CRemoteProcessorServer(uint16_t uiPort, const string &socketPath,
+                                               size_t maxClients)
+    : _uiPort(uiPort), _socketPath(socketPath), _maxClients(maxClients), _io_service(),
+      _acceptor(_io_service), _localAcceptor(_io_service)
 {
 }
 
 CRemoteProcessorServer::~CRemoteProcessorServer()
 {
     stop();
+
+    if (_localAcceptor.is_open()) {
+        ::unlink(_socketPath.c_str());
+    }
 }
 
 // State
@@ -54,6 +470,33 @@ bool CRemoteProcessorServer::start(string &error)
 {
     using namespace asio;
 
+    if (_uiPort == 0 && _socketPath.empty()) {
+
+        error = "Neither a port nor a socket path to listen on";
+        return false;
+    }
+
+    if (!_socketPath.empty()) {
+
+        try {
+            // Remove a socket left by a previous instance, binding would fail otherwise
+            ::unlink(_socketPath.c_str());
+
+            local::stream_protocol::endpoint endpoint(_socketPath);
+
+            _localAcceptor.open(endpoint.protocol());
+            _localAcceptor.bind(endpoint);
+            _localAcceptor.listen();
+        } catch (std::exception &e) {
+            error = "Unable to listen on socket " + _socketPath + ": " + e.what();
+            return false;
+        }
+    }
+
+    if (_uiPort == 0) {
+        return true;
+    }
+
     try {
         ip::tcp::endpoint endpoint(ip::tcp::v6(), _uiPort);
 
@@ -80,28 +523,40 @@ bool CRemoteProcessorServer::stop()
     return true;
 }
 
-void CRemoteProcessorServer::acceptRegister(IRemoteCommandHandler &commandHandler)
+template <class Acceptor>
+void CRemoteProcessorServer::acceptRegister(Acceptor &acceptor,
+                                            IRemoteCommandHandler &commandHandler)
 {
-    auto peerHandler = [this, &commandHandler](asio::error_code ec) {
+    auto session = std::make_shared<Session>(*this, commandHandler);
+
+    auto peerHandler = [this, &acceptor, &commandHandler, session](asio::error_code ec) {
         if (ec) {
             std::cerr << "Accept failed: " << ec.message() << std::endl;
             return;
         }
 
-        _socket.set_option(asio::ip::tcp::no_delay(true));
-        handleNewConnection(commandHandler);
-
-        _socket.close();
+        if (_clientCount >= _maxClients) {
+            std::cerr << "Connection refused: already " << _maxClients << " clients connected"
+                      << std::endl;
+            session->reject();
+        } else {
+            session->start();
+        }
 
-        acceptRegister(commandHandler);
+        acceptRegister(acceptor, commandHandler);
     };
 
-    _acceptor.async_accept(_socket, peerHandler);
+    acceptor.async_accept(session->socket(), peerHandler);
 }
 
 bool CRemoteProcessorServer::process(IRemoteCommandHandler &commandHandler)
 {
-    acceptRegister(commandHandler);
+    if (_acceptor.is_open()) {
+        acceptRegister(_acceptor, commandHandler);
+    }
+    if (_localAcceptor.is_open()) {
+        acceptRegister(_localAcceptor, commandHandler);
+    }
 
     asio::error_code ec;
 
@@ -114,55 +569,53 @@ bool CRemoteProcessorServer::process(IRemoteCommandHandler &commandHandler)
     return ec.value() == 0;
 }
 
-// New connection
-void CRemoteProcessorServer::handleNewConnection(IRemoteCommandHandler &commandHandler)
+bool CRemoteProcessorServer::hasSubscribers() const
 {
-    // Process all incoming requests from the client
-    while (true) {
+    return _subscriberCount != 0;
+}
 
-        // Process requests
-        // Create command message
-        CRequestMessage requestMessage;
+void CRemoteProcessorServer::notify(const string &strKind, const string &strEvent)
+{
+    if (_subscriberCount == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_subscriptionMutex);
 
-        string strError;
-        ///// Receive command
-        CRequestMessage::Result res;
-        res = requestMessage.serialize(Socket(_socket), false, strError);
+    for (const auto &subscriber : _subscribers) {
 
-        switch (res) {
-        case CRequestMessage::error:
-            std::cout << "Error while receiving message: " << strError << std::endl;
-        // fall through
-        case CRequestMessage::peerDisconnected:
-            // Consider peer disconnection as normal, no log
-            return; // Bail out
-        case CRequestMessage::success:
-            break; // No error, continue
+        auto session = subscriber.lock();
+        if (session) {
+            session->queueNotification(strKind, strEvent);
         }
+    }
+}
 
-        // Actually process the request
-        bool bSuccess;
+void CRemoteProcessorServer::subscribe(std::shared_ptr<Session> session)
+{
+    std::lock_guard<std::mutex> lock(_subscriptionMutex);
 
-        string strResult;
+    _subscribers.push_back(session);
+    _subscriberCount++;
+}
 
-        bSuccess = commandHandler.remoteCommandProcess(requestMessage, strResult);
+void CRemoteProcessorServer::unsubscribe(const Session *session)
+{
+    std::lock_guard<std::mutex> lock(_subscriptionMutex);
 
-        // Send back answer
-        // Create answer message
-        CAnswerMessage answerMessage(strResult, bSuccess);
+    // Also forget the sessions which have expired meanwhile
+    auto isGone = [session](const std::weak_ptr<Session> &subscriber) {
+        auto locked = subscriber.lock();
+        return !locked || locked.get() == session;
+    };
+    _subscribers.erase(std::remove_if(begin(_subscribers), end(_subscribers), isGone),
+                       end(_subscribers));
+    _subscriberCount = _subscribers.size();
+}
 
-        ///// Send answer
-        res = answerMessage.serialize(_socket, true, strError);
+bool CRemoteProcessorServer::processCommand(IRemoteCommandHandler &commandHandler,
+                                            const IRemoteCommand &command, string &strResult)
+{
+    std::lock_guard<std::mutex> lock(_commandMutex);
 
-        switch (res) {
-        case CRequestMessage::peerDisconnected:
-        // Peer should not disconnect while waiting for an answer
-        // Fall through to log the error and bail out
-        case CRequestMessage::error:
-            std::cout << "Error while receiving message: " << strError << std::endl;
-            return; // Bail out
-        case CRequestMessage::success:
-            break; // No error, continue
-        }
-    }
+    return commandHandler.remoteCommandProcess(command, strResult);
 }
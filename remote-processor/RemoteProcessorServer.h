@@ -34,30 +34,91 @@
 #include <stdint.h>
 #include "RemoteProcessorServerInterface.h"
 #include <asio.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 class IRemoteCommandHandler;
 
 class REMOTE_PROCESSOR_EXPORT CRemoteProcessorServer : public IRemoteProcessorServerInterface
 {
 public:
-    CRemoteProcessorServer(uint16_t uiPort);
+    /** Default number of clients which may be connected at the same time */
+    static const size_t defaultMaxClients = 4;
+
+    /** Number of notifications queued for a subscribed client before dropping them */
+    static const size_t maxPendingNotifications = 256;
+
+    /**
+     * @param[in] uiPort the TCP port to listen on, 0 not to listen on TCP.
+     * @param[in] maxClients the maximum number of clients served at the same time;
+     *                       further connections are closed as soon as accepted.
+     */
+    CRemoteProcessorServer(uint16_t uiPort, size_t maxClients = defaultMaxClients);
+
+    /**
+     * @param[in] uiPort the TCP port to listen on, 0 not to listen on TCP.
+     * @param[in] socketPath the path of a Unix domain socket to listen on,
+     *                       empty not to listen on a Unix domain socket.
+     * @param[in] maxClients the maximum number of clients served at the same time,
+     *                       whatever the socket they are connected to.
+     */
+    CRemoteProcessorServer(uint16_t uiPort, const std::string &socketPath, size_t maxClients);
     virtual ~CRemoteProcessorServer();
 
     // State
     virtual bool start(std::string &error);
     virtual bool stop();
+
+    // Notifications, may be called from any thread
+    bool hasSubscribers() const override;
+    void notify(const std::string &strKind, const std::string &strEvent) override;
+
+    /** Serve clients until stopped
+     *
+     * Each client connection is an asynchronous session on the io_service:
+     * clients are served concurrently but their commands are processed one at a
+     * time, even if process is called from several threads.
+     */
     bool process(IRemoteCommandHandler &commandHandler);
 
 private:
-    void acceptRegister(IRemoteCommandHandler &commandHandler);
+    /** A client connection, owned by the handlers of its pending operations */
+    class Session;
 
-    // New connection
-    void handleNewConnection(IRemoteCommandHandler &commandHandler);
+    template <class Acceptor>
+    void acceptRegister(Acceptor &acceptor, IRemoteCommandHandler &commandHandler);
+
+    /** Register a session to receive notifications */
+    void subscribe(std::shared_ptr<Session> session);
+    /** Unregister a session, also forgetting expired ones */
+    void unsubscribe(const Session *session);
+
+    /** Process a command on behalf of a session, serialized with the other sessions */
+    bool processCommand(IRemoteCommandHandler &commandHandler, const IRemoteCommand &command,
+                        std::string &strResult);
 
     // Port number
     uint16_t _uiPort;
+    // Unix domain socket path
+    std::string _socketPath;
+
+    /** Maximum number of connected clients */
+    size_t _maxClients;
+    /** Number of clients currently connected */
+    std::atomic<size_t> _clientCount{0};
+
+    /** Commands are not processed concurrently */
+    std::mutex _commandMutex;
+
+    /** Protects subscribers and their notification queues */
+    std::mutex _subscriptionMutex;
+    std::vector<std::weak_ptr<Session>> _subscribers;
+    std::atomic<size_t> _subscriberCount{0};
 
     asio::io_service _io_service;
     asio::ip::tcp::acceptor _acceptor;
-    asio::ip::tcp::socket _socket;
+    asio::local::stream_protocol::acceptor _localAcceptor;
 };
@@ -38,6 +38,22 @@ public:
     virtual bool start(std::string &strError) = 0;
     virtual bool stop() = 0;
 
+    /** @return true if at least one client subscribed to notifications
+     *
+     * Allows to skip the formatting of events nobody listens to.
+     */
+    virtual bool hasSubscribers() const = 0;
+
+    /** Notify an event to the clients subscribed to its kind
+     *
+     * Never blocks on clients: events are queued and, if a client queue is
+     * full, dropped and counted.
+     *
+     * @param[in] strKind the kind of event, e.g. "criterion".
+     * @param[in] strEvent the event description.
+     */
+    virtual void notify(const std::string &strKind, const std::string &strEvent) = 0;
+
     /* FIXME this was missing but is explicitly called */
     virtual ~IRemoteProcessorServerInterface() {}
 };
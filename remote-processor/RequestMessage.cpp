@@ -65,6 +65,31 @@ void CRequestMessage::addArgument(const string &strArgument)
     _argumentVector.push_back(trim(strArgument));
 }
 
+void CRequestMessage::addBinaryArgument(const string &strArgument)
+{
+    setMsgId(MsgType::EBinaryCommandRequest);
+
+    _argumentVector.push_back(strArgument);
+}
+
+void CRequestMessage::acceptChunkedAnswer()
+{
+    if (getMsgId() == MsgType::ECommandRequest) {
+
+        setMsgId(MsgType::EChunkedCommandRequest);
+    }
+}
+
+void CRequestMessage::setAnswerChunkSender(AnswerChunkSender sender)
+{
+    _answerChunkSender = sender;
+}
+
+bool CRequestMessage::sendAnswerChunk(const string &strChunk) const
+{
+    return _answerChunkSender && _answerChunkSender(strChunk);
+}
+
 size_t CRequestMessage::getArgumentCount() const
 {
     return _argumentVector.size();
@@ -104,24 +129,33 @@ void CRequestMessage::fillDataToSend()
 }
 
 // Collect received data
-void CRequestMessage::collectReceivedData()
+bool CRequestMessage::collectReceivedData()
 {
     // Receive command
     string strCommand;
 
-    readString(strCommand);
-
+    if (!readString(strCommand)) {
+        return false;
+    }
     setCommand(strCommand);
 
-    // Arguments
+    // Arguments of binary requests are kept as is
+    bool bBinary = getMsgId() == MsgType::EBinaryCommandRequest;
+
     while (getRemainingDataSize()) {
 
         string strArgument;
 
-        readString(strArgument);
-
-        addArgument(strArgument);
+        if (!readString(strArgument)) {
+            return false;
+        }
+        if (bBinary) {
+            _argumentVector.push_back(strArgument);
+        } else {
+            addArgument(strArgument);
+        }
     }
+    return true;
 }
 
 // Size
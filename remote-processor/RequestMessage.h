@@ -33,6 +33,7 @@
 
 #include "Message.h"
 #include "RemoteCommand.h"
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -48,11 +49,34 @@ public:
 
     // Arguments
     void addArgument(const std::string &strArgument) override;
+
+    /** Add an argument made of raw bytes
+     *
+     * Unlike addArgument, the argument is not trimmed. The request is then sent
+     * as a binary command request, whose arguments are not trimmed on reception.
+     *
+     * @param[in] strArgument the bytes of the argument
+     */
+    void addBinaryArgument(const std::string &strArgument);
     size_t getArgumentCount() const override;
     const std::string &getArgument(size_t argument) const override;
     const std::vector<std::string> &getArguments() const override;
     std::string packArguments(size_t startArgument, size_t nbArguments) const override;
 
+    /** Ask for the answer to be sent by chunks, if the command supports it
+     *
+     * The answer is then received as zero or more CAnswerChunkMessage followed
+     * by a CAnswerMessage. Servers not supporting chunks only send the latter.
+     * Binary requests can not be chunked.
+     */
+    void acceptChunkedAnswer();
+
+    using AnswerChunkSender = std::function<bool(const std::string &strChunk)>;
+
+    /** Set how to send answer chunks, on the receiving side of a chunked request */
+    void setAnswerChunkSender(AnswerChunkSender sender);
+    bool sendAnswerChunk(const std::string &strChunk) const override;
+
 private:
     /**
       * Constant character array.
@@ -64,7 +88,7 @@ private:
     // Fill data to send
     void fillDataToSend() override;
     // Collect received data
-    void collectReceivedData() override;
+    bool collectReceivedData() override;
     // Size
     /**
      * @return size of the request message in bytes
@@ -77,4 +101,6 @@ private:
     std::string _strCommand;
     // Arguments
     std::vector<std::string> _argumentVector;
+
+    AnswerChunkSender _answerChunkSender;
 };
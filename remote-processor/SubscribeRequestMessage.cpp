@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "SubscribeRequestMessage.h"
+
+#define base CMessage
+
+using std::string;
+
+CSubscribeRequestMessage::CSubscribeRequestMessage() : base(MsgType::ESubscribeRequest)
+{
+}
+
+void CSubscribeRequestMessage::addKind(const string &strKind)
+{
+    _kinds.push_back(strKind);
+}
+
+const std::vector<string> &CSubscribeRequestMessage::getKinds() const
+{
+    return _kinds;
+}
+
+// Fill data to send
+void CSubscribeRequestMessage::fillDataToSend()
+{
+    for (const auto &kind : _kinds) {
+
+        writeString(kind);
+    }
+}
+
+// Collect received data
+bool CSubscribeRequestMessage::collectReceivedData()
+{
+    _kinds.clear();
+
+    while (getRemainingDataSize()) {
+
+        string strKind;
+
+        if (!readString(strKind)) {
+            return false;
+        }
+        addKind(strKind);
+    }
+    return true;
+}
+
+// Size
+size_t CSubscribeRequestMessage::getDataSize() const
+{
+    size_t uiSize = 0;
+
+    for (const auto &kind : _kinds) {
+
+        uiSize += getStringSize(kind);
+    }
+    return uiSize;
+}
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "AnswerChunkMessage.h"
+#include "AnswerMessage.h"
+#include "BatchAnswerMessage.h"
+#include "BatchRequestMessage.h"
+#include "NotificationMessage.h"
+#include "SubscribeRequestMessage.h"
+
+#include <catch.hpp>
+
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/** Decode a whole frame as the asynchronous server does */
+bool decode(const std::vector<uint8_t> &frame, CMessage &message, std::string &error)
+{
+    CMessage::MsgType msgId;
+    uint8_t flags;
+    size_t remainingSize;
+
+    if (!CMessage::decodeHeader(frame.data(), msgId, flags, remainingSize, error)) {
+        return false;
+    }
+    REQUIRE(frame.size() == CMessage::headerSize + remainingSize);
+    return message.decodePayload(msgId, flags, frame.data() + CMessage::headerSize,
+                                 remainingSize, error);
+}
+
+/** Decode a frame whose data lacks its last bytes, its checksum being valid */
+bool decodeTruncated(const std::vector<uint8_t> &frame, size_t removed, CMessage &message,
+                     std::string &error)
+{
+    CMessage::MsgType msgId;
+    uint8_t flags;
+    size_t remainingSize;
+
+    REQUIRE(CMessage::decodeHeader(frame.data(), msgId, flags, remainingSize, error));
+    REQUIRE(removed < remainingSize);
+
+    // Data without its last bytes, then the checksum
+    std::vector<uint8_t> payload(begin(frame) + CMessage::headerSize, end(frame) - 1 - removed);
+    payload.push_back(std::accumulate(begin(payload), end(payload),
+                                      static_cast<uint8_t>(static_cast<uint8_t>(msgId) | flags)));
+
+    return message.decodePayload(msgId, flags, payload.data(), payload.size(), error);
+}
+
+/** Forge a compressed answer frame announcing the given decompressed size */
+std::vector<uint8_t> forgeCompressedFrame(uint32_t decompressedSize)
+{
+    const uint16_t syncWord = 0xBABE;
+    const uint8_t msgId =
+        static_cast<uint8_t>(CMessage::MsgType::ESuccessAnswer) | CMessage::compressedFlag;
+
+    // Announced decompressed size followed by a few bytes of garbage
+    std::vector<uint8_t> data(sizeof(decompressedSize) + 6, 0x42);
+    memcpy(data.data(), &decompressedSize, sizeof(decompressedSize));
+    uint32_t size = static_cast<uint32_t>(sizeof(msgId) + data.size());
+
+    std::vector<uint8_t> frame(CMessage::headerSize);
+    memcpy(frame.data(), &syncWord, sizeof(syncWord));
+    memcpy(frame.data() + sizeof(syncWord), &size, sizeof(size));
+    frame[sizeof(syncWord) + sizeof(size)] = msgId;
+    frame.insert(end(frame), begin(data), end(data));
+    frame.push_back(std::accumulate(begin(data), end(data), msgId));
+
+    return frame;
+}
+} // namespace
+
+SCENARIO("Message compression", "[remote]")
+{
+    std::string error;
+
+    GIVEN ("A large answer sent to a peer which decodes compressed messages") {
+        std::string answer(4 * CMessage::compressionThreshold, 'a');
+        CAnswerMessage sent(answer, true);
+        sent.advertiseCompression();
+        sent.allowCompression();
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+        CHECK(frame.size() < answer.size());
+
+        THEN ("It should be decoded by a peer which offered compression") {
+            CAnswerMessage received;
+            received.advertiseCompression();
+            REQUIRE(decode(frame, received, error));
+            CHECK(received.getAnswer() == answer);
+            CHECK(received.peerAcceptsCompression());
+        }
+        THEN ("It should be rejected by a peer which never offered compression") {
+            CAnswerMessage received;
+            CHECK_FALSE(decode(frame, received, error));
+        }
+    }
+    GIVEN ("A forged compressed frame announcing a huge decompressed size") {
+        std::vector<uint8_t> frame = forgeCompressedFrame(0xFFFFFFFF);
+
+        THEN ("It should be rejected before allocating the decompressed data") {
+            CAnswerMessage received;
+            received.advertiseCompression();
+            CHECK_FALSE(decode(frame, received, error));
+            CHECK(error.find("too large") != std::string::npos);
+        }
+    }
+    GIVEN ("A forged compressed frame announcing more than deflate can achieve") {
+        std::vector<uint8_t> frame = forgeCompressedFrame(1024 * 1024);
+
+        THEN ("It should be rejected") {
+            CAnswerMessage received;
+            received.advertiseCompression();
+            CHECK_FALSE(decode(frame, received, error));
+            CHECK(error.find("too large") != std::string::npos);
+        }
+    }
+}
+
+SCENARIO("Notification messages", "[remote]")
+{
+    std::string error;
+
+    GIVEN ("A subscription to some kinds of events") {
+        CSubscribeRequestMessage sent;
+        sent.addKind("criterion");
+        sent.addKind("configuration");
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+
+        THEN ("It should be decoded with its kinds") {
+            CSubscribeRequestMessage received;
+            REQUIRE(decode(frame, received, error));
+            CHECK(received.getKinds() == sent.getKinds());
+        }
+    }
+    GIVEN ("A subscription to all events") {
+        CSubscribeRequestMessage sent;
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+
+        THEN ("It should be decoded without any kind") {
+            CSubscribeRequestMessage received;
+            REQUIRE(decode(frame, received, error));
+            CHECK(received.getKinds().empty());
+        }
+    }
+    GIVEN ("A notification following dropped ones") {
+        CNotificationMessage sent("criterion", "Mode = on", 42);
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+
+        THEN ("It should be decoded with its kind, event and dropped count") {
+            CNotificationMessage received;
+            REQUIRE(decode(frame, received, error));
+            CHECK(received.getKind() == "criterion");
+            CHECK(received.getEvent() == "Mode = on");
+            CHECK(received.getDropped() == 42);
+        }
+        THEN ("It should be rejected if truncated") {
+            size_t dataSize = frame.size() - CMessage::headerSize - 1;
+            for (size_t removed = 1; removed <= dataSize; removed++) {
+                CAPTURE(removed);
+                CNotificationMessage received;
+                CHECK_FALSE(decodeTruncated(frame, removed, received, error));
+            }
+        }
+    }
+}
+
+SCENARIO("Message framing", "[remote]")
+{
+    std::string error;
+
+    GIVEN ("A forged header announcing a huge frame") {
+        // Sync word, size, then message id
+        const std::vector<uint8_t> header = {0xBE, 0xBA, 0xF0, 0xFF, 0xFF, 0xFF, 0x01};
+        REQUIRE(header.size() == size_t{CMessage::headerSize});
+
+        THEN ("It should be rejected before allocating the frame") {
+            CMessage::MsgType msgId;
+            uint8_t flags;
+            size_t remainingSize;
+            CHECK_FALSE(CMessage::decodeHeader(header.data(), msgId, flags, remainingSize, error));
+            CHECK(error.find("too large") != std::string::npos);
+        }
+    }
+}
+
+SCENARIO("Batch messages", "[remote]")
+{
+    std::string error;
+
+    GIVEN ("A batch of commands to stop on error") {
+        CBatchRequestMessage sent(true);
+        sent.addCommand("getParameter").addArgument("/a/b");
+        IRemoteCommand &set = sent.addCommand("setParameter");
+        set.addArgument("/a/c");
+        set.addArgument("1");
+        sent.addCommand("status");
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+
+        THEN ("It should be decoded with its flag, commands and arguments") {
+            CBatchRequestMessage received;
+            REQUIRE(decode(frame, received, error));
+            CHECK(received.stopOnError());
+            REQUIRE(received.getCommandCount() == 3);
+            for (size_t command = 0; command < 3; command++) {
+                CHECK(received.getCommand(command).getCommand() ==
+                      sent.getCommand(command).getCommand());
+                CHECK(received.getCommand(command).getArguments() ==
+                      sent.getCommand(command).getArguments());
+            }
+        }
+        THEN ("It should be rejected if truncated") {
+            size_t dataSize = frame.size() - CMessage::headerSize - 1;
+            for (size_t removed = 1; removed <= dataSize; removed++) {
+                CAPTURE(removed);
+                CBatchRequestMessage received;
+                CHECK_FALSE(decodeTruncated(frame, removed, received, error));
+                CHECK(error == "Truncated message data");
+            }
+        }
+    }
+    GIVEN ("The answer to a batch") {
+        CBatchAnswerMessage sent;
+        sent.addResult(true, "1");
+        sent.addResult(false, "Unknown parameter");
+
+        std::vector<uint8_t> frame;
+        sent.encode(frame);
+
+        THEN ("It should be decoded with the status of each command") {
+            CBatchAnswerMessage received;
+            REQUIRE(decode(frame, received, error));
+            REQUIRE(received.getResultCount() == 2);
+            CHECK(received.success(0));
+            CHECK(received.getAnswer(0) == "1");
+            CHECK_FALSE(received.success(1));
+            CHECK(received.getAnswer(1) == "Unknown parameter");
+        }
+        THEN ("It should be rejected if truncated") {
+            size_t dataSize = frame.size() - CMessage::headerSize - 1;
+            for (size_t removed = 1; removed <= dataSize; removed++) {
+                CAPTURE(removed);
+                CBatchAnswerMessage received;
+                CHECK_FALSE(decodeTruncated(frame, removed, received, error));
+            }
+        }
+    }
+}
+
+SCENARIO("Chunked answers", "[remote]")
+{
+    std::string error;
+
+    GIVEN ("An answer sent as chunks followed by the final answer") {
+        const std::vector<std::string> chunks = {"<Domains>", "<Domain/>", ""};
+        const std::string last = "</Domains>";
+
+        // As sent on the socket, one frame after the other
+        std::vector<std::vector<uint8_t>> frames;
+        for (auto &chunk : chunks) {
+            CAnswerChunkMessage chunkMessage(chunk);
+            frames.emplace_back();
+            chunkMessage.encode(frames.back());
+        }
+        CAnswerMessage answerMessage(last, true);
+        frames.emplace_back();
+        answerMessage.encode(frames.back());
+
+        THEN ("The chunks then the final answer should be decoded, making the whole answer") {
+            std::string answer;
+            for (size_t frame = 0; frame < frames.size(); frame++) {
+                CAPTURE(frame);
+                CAnswerMessage received;
+                REQUIRE(decode(frames[frame], received, error));
+                CHECK(received.isChunk() == (frame < chunks.size()));
+                answer += received.getAnswer();
+                // Only the final answer has a status
+                if (!received.isChunk()) {
+                    CHECK(received.success());
+                }
+            }
+            CHECK(answer == "<Domains><Domain/></Domains>");
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BenchmarkRegistry.h"
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+Registry &Registry::instance()
+{
+    static Registry registry;
+    return registry;
+}
+
+bool Registry::record(const Call &call, bool &bOpensTransaction)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    size_t &transactionCalls = mTransactionCalls[call.subsystem];
+    bOpensTransaction = transactionCalls == 0;
+    transactionCalls = (transactionCalls + 1) % call.batch;
+
+    CallCounts &counts = mCallCounts[call.path];
+    if (call.bReceive) {
+        counts.receives++;
+    } else {
+        counts.sends++;
+    }
+    counts.bytes += call.bytes;
+    if (bOpensTransaction) {
+        counts.transactions++;
+    }
+
+    // Spread the failures evenly, so that runs are reproducible
+    size_t calls = counts.sends + counts.receives;
+    bool bFails = calls * call.failureRate / 100 != (calls - 1) * call.failureRate / 100;
+    if (bFails) {
+        counts.failures++;
+    }
+    return !bFails;
+}
+
+std::map<std::string, CallCounts> Registry::getCallCounts()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCallCounts;
+}
+
+void Registry::reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCallCounts.clear();
+    mTransactionCalls.clear();
+}
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "BenchmarkEntryPoint.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+/** Call counts of all the subsystem objects, and transaction state of all the subsystems */
+class Registry
+{
+public:
+    static Registry &instance();
+
+    /** Call to the simulated hardware of a subsystem object */
+    struct Call
+    {
+        /** Path of the subsystem object element */
+        std::string path;
+        std::string subsystem;
+        bool bReceive;
+        size_t bytes;
+        /** Consecutive calls of the subsystem sharing a transaction */
+        size_t batch;
+        /** Percentage of the calls of the object which fail */
+        size_t failureRate;
+    };
+
+    /** Count a call
+     *
+     * @param[in] call the call to count
+     * @param[out] bOpensTransaction whether the call opens a new transaction of its subsystem
+     * @return false if the call is to fail
+     */
+    bool record(const Call &call, bool &bOpensTransaction);
+
+    std::map<std::string, CallCounts> getCallCounts();
+    void reset();
+
+private:
+    std::mutex mMutex;
+    std::map<std::string, CallCounts> mCallCounts;
+    /** Calls of the current transaction, by subsystem */
+    std::map<std::string, size_t> mTransactionCalls;
+};
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
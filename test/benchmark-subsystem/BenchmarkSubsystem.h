@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <Subsystem.h>
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+/** Context mapping keys, setting the simulated hardware costs of the subsystem objects */
+enum MappingKey
+{
+    /** Fixed cost of a transaction, in microseconds */
+    ELatency,
+    /** Cost of each byte transferred, in nanoseconds */
+    EByteCost,
+    /** Percentage of the calls which fail */
+    EFailureRate,
+    /** Consecutive calls of the subsystem sharing a transaction, 1 by default */
+    EBatch
+};
+
+/** This subsystem simulates the cost of synchronizing its objects with the hardware and
+ * counts the calls, see getCallCounts() */
+class Subsystem : public CSubsystem
+{
+public:
+    Subsystem(const std::string &name, core::log::Logger &logger);
+
+private:
+    using base = CSubsystem;
+};
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BenchmarkSubsystemObject.h"
+#include "BenchmarkSubsystem.h"
+#include "BenchmarkRegistry.h"
+#include <InstanceConfigurableElement.h>
+#include <MappingContext.h>
+#include <Subsystem.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+SubsystemObject::SubsystemObject(const std::string & /*mappingValue*/,
+                                 CInstanceConfigurableElement *instanceConfigurableElement,
+                                 const CMappingContext &context, core::log::Logger &logger)
+    : base(instanceConfigurableElement, logger), mPath(instanceConfigurableElement->getPath()),
+      mSubsystem(instanceConfigurableElement->getBelongingSubsystem()->getName()),
+      mLatency(context.getItemAsInteger(ELatency)),
+      mByteCost(context.getItemAsInteger(EByteCost)),
+      mFailureRate(std::min<size_t>(context.getItemAsInteger(EFailureRate), 100)),
+      mBatch(std::max<size_t>(context.getItemAsInteger(EBatch), 1)), mHardware(getSize())
+{
+}
+
+bool SubsystemObject::sendToHW(std::string &error)
+{
+    blackboardRead(mHardware.data(), mHardware.size());
+    return simulate(false, error);
+}
+
+bool SubsystemObject::receiveFromHW(std::string &error)
+{
+    if (!simulate(true, error)) {
+        return false;
+    }
+    blackboardWrite(mHardware.data(), mHardware.size());
+    return true;
+}
+
+bool SubsystemObject::simulate(bool bReceive, std::string &error)
+{
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+
+    bool bOpensTransaction;
+    bool bSuccess = Registry::instance().record(
+        {mPath, mSubsystem, bReceive, mHardware.size(), mBatch, mFailureRate},
+        bOpensTransaction);
+
+    std::chrono::nanoseconds cost(mByteCost * mHardware.size());
+    if (bOpensTransaction) {
+        cost += std::chrono::microseconds(mLatency);
+    }
+    // Busy wait, sleeping is far too coarse for microsecond costs
+    while (Clock::now() - start < cost) {
+    }
+
+    if (!bSuccess) {
+        error = "Simulated failure of " + mPath;
+    }
+    return bSuccess;
+}
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
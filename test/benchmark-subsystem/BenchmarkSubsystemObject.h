@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <SubsystemObject.h>
+#include <string>
+#include <vector>
+
+class CMappingContext;
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+/** This subsystem object keeps the value of its element, of any size, in a simulated
+ * hardware buffer. Each synchronization busy waits for the cost configured by the mapping
+ * context and is counted in the registry.
+ */
+class SubsystemObject final : public CSubsystemObject
+{
+public:
+    SubsystemObject(const std::string &mappingValue,
+                    CInstanceConfigurableElement *instanceConfigurableElement,
+                    const CMappingContext &context, core::log::Logger &logger);
+
+private:
+    using base = CSubsystemObject;
+
+    virtual bool sendToHW(std::string &error) override;
+    virtual bool receiveFromHW(std::string &error) override;
+
+    /** Count the call and wait for its simulated cost
+     * @return false, filling error, if the call is to fail */
+    bool simulate(bool bReceive, std::string &error);
+
+    const std::string mPath;
+    const std::string mSubsystem;
+    const size_t mLatency;
+    const size_t mByteCost;
+    const size_t mFailureRate;
+    const size_t mBatch;
+
+    /** Simulated hardware content */
+    std::vector<char> mHardware;
+};
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
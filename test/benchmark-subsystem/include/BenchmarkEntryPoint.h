@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "benchmark_subsystem_export.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace parameterFramework
+{
+namespace benchmarkSubsystem
+{
+
+/** Calls to the simulated hardware of a subsystem object */
+struct CallCounts
+{
+    /** Synchronizations from the blackboard to the hardware */
+    size_t sends = 0;
+    /** Synchronizations from the hardware to the blackboard */
+    size_t receives = 0;
+    /** Simulated failures, of sends and receives */
+    size_t failures = 0;
+    /** Bytes transferred */
+    size_t bytes = 0;
+    /** Transactions opened: only the first call of a batch opens one */
+    size_t transactions = 0;
+};
+
+/** @return the call counts of each subsystem object called so far, by element path */
+BENCHMARK_SUBSYSTEM_EXPORT std::map<std::string, CallCounts> getCallCounts();
+
+BENCHMARK_SUBSYSTEM_EXPORT void resetCallCounts();
+} // namespace benchmarkSubsystem
+} // namespace parameterFramework
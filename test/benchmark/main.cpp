@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Microbenchmarks of the parameter framework core engine
+ *
+ * Each benchmark repeats an operation, doubling the iteration count until the
+ * measure lasts long enough. The mean time per operation is printed as JSON.
+ */
+
+#include "ConfigFiles.hpp"
+#include "BenchmarkEntryPoint.h"
+#include "ScaleGenerator.hpp"
+#include "ParameterMgrFullConnector.h"
+#include "ElementHandle.h"
+#include "SelectionCriterionInterface.h"
+#include "SelectionCriterionTypeInterface.h"
+#include "Tokenizer.h"
+#include "Utility.h"
+#include "convert.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using parameterFramework::Config;
+using parameterFramework::ConfigFiles;
+using scaleGenerator::Criterion;
+
+using Clock = std::chrono::steady_clock;
+
+/** Sizes of the generated configuration */
+struct Sizes
+{
+    size_t domains = 50;
+    size_t configurations = 10;
+    /** Parameters per domain */
+    size_t parameters = 4;
+    /** Length of the array parameter accessed through a handle */
+    size_t arrayLength = 64;
+};
+
+/** Simulated hardware of the parameter blocks, see the benchmark-subsystem */
+struct Hardware
+{
+    bool bSimulated = false;
+    /** Fixed cost of a transaction, in microseconds */
+    size_t latency = 0;
+    /** Cost of each byte, in nanoseconds */
+    size_t byteCost = 0;
+    /** Consecutive synchronizations sharing a transaction */
+    size_t batch = 1;
+};
+
+static void check(bool bSuccess, const string &strError)
+{
+    if (!bSuccess) {
+        throw runtime_error(strError);
+    }
+}
+
+/** Generate one parameter block per domain and two rogue parameters, "scalar" and "array"
+ *
+ * Configuration c of each domain is applicable when the "Mode" criterion is in state c.
+ * If the hardware is simulated, each parameter block and rogue parameter is a benchmark
+ * subsystem object.
+ */
+static Config createConfig(const Sizes &sizes, const Hardware &hardware)
+{
+    Config config;
+    string blockMapping;
+
+    if (hardware.bSimulated) {
+        config.plugins = {{"", {"benchmark-subsystem"}}};
+        config.subsystemType = "BENCHMARK";
+        config.subsystemMapping = "Latency:" + to_string(hardware.latency) + ",ByteCost:" +
+                                  to_string(hardware.byteCost) + ",Batch:" +
+                                  to_string(hardware.batch);
+        blockMapping = " Mapping='Object'";
+    }
+
+    for (size_t domain = 0; domain < sizes.domains; domain++) {
+
+        string block = "block" + to_string(domain);
+        string path = "/test/test/" + block;
+
+        config.instances += "<ParameterBlock Name='" + block + "'" + blockMapping + ">";
+        for (size_t parameter = 0; parameter < sizes.parameters; parameter++) {
+            config.instances +=
+                "<IntegerParameter Name='param" + to_string(parameter) + "' Size='32'/>";
+        }
+        config.instances += "</ParameterBlock>\n";
+
+        string configurations;
+        string settings;
+        for (size_t configuration = 0; configuration < sizes.configurations; configuration++) {
+
+            string name = "conf" + to_string(configuration);
+            configurations += "<Configuration Name='" + name +
+                              "'><CompoundRule Type='All'><SelectionCriterionRule "
+                              "SelectionCriterion='Mode' MatchesWhen='Is' Value='state" +
+                              to_string(configuration) + "'/></CompoundRule></Configuration>";
+
+            settings += "<Configuration Name='" + name + "'><ConfigurableElement Path='" + path +
+                        "'><ParameterBlock Name='" + block + "'>";
+            for (size_t parameter = 0; parameter < sizes.parameters; parameter++) {
+                settings += "<IntegerParameter Name='param" + to_string(parameter) + "'>" +
+                            to_string(configuration) + "</IntegerParameter>";
+            }
+            settings += "</ParameterBlock></ConfigurableElement></Configuration>";
+        }
+
+        config.domains += "<ConfigurableDomain Name='domain" + to_string(domain) +
+                          "'><Configurations>" + configurations +
+                          "</Configurations><ConfigurableElements><ConfigurableElement Path='" +
+                          path + "'/></ConfigurableElements><Settings>" + settings +
+                          "</Settings></ConfigurableDomain>\n";
+    }
+    // Rogue parameters are set through handles, so need a syncer as well
+    config.instances += "<IntegerParameter Name='scalar' Size='32'" + blockMapping + "/>";
+    config.instances += "<IntegerParameter Name='array' Size='32' ArrayLength='" +
+                        to_string(sizes.arrayLength) + "'" + blockMapping + "/>";
+    return config;
+}
+
+/** Parameter framework started with the given exclusive criteria */
+struct Pfw
+{
+    Pfw(const string &configurationPath, const vector<Criterion> &criteria)
+        : connector(configurationPath)
+    {
+        string strError;
+
+        connector.setLogger(nullptr);
+        connector.setForceNoRemoteInterface(true);
+
+        for (auto &criterion : criteria) {
+
+            ISelectionCriterionTypeInterface *type = connector.createSelectionCriterionType(false);
+            for (size_t state = 0; state < criterion.states.size(); state++) {
+                int value = static_cast<int>(state);
+                check(type->addValuePair(value, criterion.states[state], strError), strError);
+            }
+            modes.push_back(connector.createSelectionCriterion(criterion.name, type));
+        }
+
+        check(connector.start(strError), strError);
+    }
+
+    CParameterMgrFullConnector connector;
+    vector<ISelectionCriterionInterface *> modes;
+};
+
+/** Run the benchmarks and collect their results */
+class Runner
+{
+public:
+    Runner(double minTime, const string &filter) : mMinTime(minTime), mFilter(filter) {}
+
+    /** Time an operation if its name matches the filter
+     *
+     * The operation is run once to warm up, then the iteration count is doubled until
+     * the measure lasts at least the minimum time.
+     */
+    void run(const string &name, const function<void()> &operation)
+    {
+        if (name.find(mFilter) == string::npos) {
+            return;
+        }
+        operation();
+
+        for (uint64_t iterations = 1;; iterations *= 2) {
+
+            auto start = Clock::now();
+            for (uint64_t iteration = 0; iteration < iterations; iteration++) {
+                operation();
+            }
+            chrono::duration<double> elapsed = Clock::now() - start;
+
+            if (elapsed.count() >= mMinTime) {
+                double nsPerOperation = elapsed.count() * 1e9 / static_cast<double>(iterations);
+                mResults.push_back({name, iterations, nsPerOperation});
+                cerr << name << ": " << mResults.back().nsPerOperation << " ns" << endl;
+                return;
+            }
+        }
+    }
+
+    /** @param[in] context JSON object describing the benchmarked configuration */
+    void write(ostream &output, const string &context) const
+    {
+        output << "{\"context\":" << context << ",\"benchmarks\":[";
+        for (size_t index = 0; index < mResults.size(); index++) {
+
+            const Result &result = mResults[index];
+            output << (index == 0 ? "" : ",") << "{\"name\":" << utility::asJsonString(result.name)
+                   << ",\"iterations\":" << result.iterations
+                   << ",\"ns_per_op\":" << result.nsPerOperation << "}";
+        }
+        output << "]}" << endl;
+    }
+
+private:
+    struct Result
+    {
+        string name;
+        uint64_t iterations;
+        double nsPerOperation;
+    };
+
+    double mMinTime;
+    string mFilter;
+    vector<Result> mResults;
+};
+
+/** Benchmarks which apply to any configuration
+ *
+ * The switch benchmark cycles the first criterion between its first two states.
+ */
+static void runEngineBenchmarks(Runner &runner, const string &configurationPath,
+                                const vector<Criterion> &criteria)
+{
+    string strError;
+
+    // Parse the top level configuration, the structure and the settings then start
+    runner.run("xml/load", [&] { Pfw{configurationPath, criteria}; });
+
+    Pfw pfw(configurationPath, criteria);
+    CParameterMgrFullConnector &connector = pfw.connector;
+
+    // The criteria do not change: each domain evaluates its rules but nothing is restored
+    runner.run("rule evaluation", [&] { connector.applyConfigurations(); });
+
+    if (!criteria.empty() && criteria.front().states.size() >= 2) {
+        int state = 0;
+        runner.run("applyConfigurations/switch", [&] {
+            state = 1 - state;
+            pfw.modes.front()->setCriterionState(state);
+            connector.applyConfigurations();
+        });
+    }
+
+    runner.run("xml/export", [&] {
+        string xml;
+        check(connector.exportDomainsXml(xml, true, false, strError), strError);
+    });
+}
+
+/** Benchmarks of the built-in configuration */
+static void runBenchmarks(Runner &runner, const Sizes &sizes, const Hardware &hardware)
+{
+    string strError;
+    ConfigFiles files(createConfig(sizes, hardware));
+    const string configurationPath = files.getPath();
+
+    // Each application switches the configuration of every domain
+    Criterion mode{"Mode", {}};
+    for (size_t state = 0; state < sizes.configurations; state++) {
+        mode.states.push_back("state" + to_string(state));
+    }
+    vector<Criterion> criteria{mode};
+
+    runEngineBenchmarks(runner, configurationPath, criteria);
+
+    Pfw pfw(configurationPath, criteria);
+    CParameterMgrFullConnector &connector = pfw.connector;
+
+    unique_ptr<ElementHandle> scalar(connector.createElementHandle("/test/test/scalar", strError));
+    check(scalar != nullptr, strError);
+    uint32_t value = 0;
+    runner.run("ElementHandle/scalar/set",
+               [&] { check(scalar->setAsInteger(++value, strError), strError); });
+    runner.run("ElementHandle/scalar/get",
+               [&] { check(scalar->getAsInteger(value, strError), strError); });
+
+    unique_ptr<ElementHandle> array(connector.createElementHandle("/test/test/array", strError));
+    check(array != nullptr, strError);
+    vector<uint32_t> values(sizes.arrayLength, 1);
+    runner.run("ElementHandle/array/set",
+               [&] { check(array->setAsIntegerArray(values, strError), strError); });
+    runner.run("ElementHandle/array/get",
+               [&] { check(array->getAsIntegerArray(values, strError), strError); });
+
+    // Resolve the path of the last parameter of the last domain
+    string deepPath = "/test/test/block" + to_string(sizes.domains - 1) + "/param" +
+                      to_string(sizes.parameters - 1);
+    runner.run("path resolution", [&] {
+        unique_ptr<ElementHandle> handle(connector.createElementHandle(deepPath, strError));
+        check(handle != nullptr, strError);
+    });
+
+    // Copies between the main blackboard and the configuration blackboards
+    check(connector.setTuningMode(true, strError), strError);
+    runner.run("blackboard/restoreConfiguration", [&] {
+        CParameterMgrFullConnector::Results errors;
+        check(connector.restoreConfiguration("domain0", "conf1", errors), "Restore failed");
+    });
+    runner.run("blackboard/saveConfiguration", [&] {
+        check(connector.saveConfiguration("domain0", "conf1", strError), strError);
+    });
+}
+
+/** @return the simulated hardware settings and its total calls and transactions, as JSON */
+static string describeHardware(const Hardware &hardware)
+{
+    size_t calls = 0;
+    size_t transactions = 0;
+    for (auto &object : parameterFramework::benchmarkSubsystem::getCallCounts()) {
+        calls += object.second.sends + object.second.receives;
+        transactions += object.second.transactions;
+    }
+    return "{\"latency_us\":" + to_string(hardware.latency) + ",\"byte_cost_ns\":" +
+           to_string(hardware.byteCost) + ",\"batch\":" + to_string(hardware.batch) +
+           ",\"calls\":" + to_string(calls) + ",\"transactions\":" + to_string(transactions) +
+           "}";
+}
+
+/** Read the criteria of a generated configuration: one per line, its name then its states */
+static vector<Criterion> readCriteria(const string &path)
+{
+    ifstream file(path);
+    if (!file) {
+        throw runtime_error("Could not read " + path);
+    }
+    vector<Criterion> criteria;
+    string line;
+    while (getline(file, line)) {
+
+        vector<string> words = Tokenizer(line).split();
+        if (!words.empty()) {
+            criteria.push_back({words.front(), {begin(words) + 1, end(words)}});
+        }
+    }
+    return criteria;
+}
+
+static void showUsage()
+{
+    cerr << "pfw-benchmark [--domains <count>] [--configurations <count>] "
+            "[--parameters <count per domain>] [--array-length <length>] "
+            "[--min-time <seconds>] [--filter <benchmark name part>]\n"
+            "              [--latency <us>] [--byte-cost <ns>] [--batch <calls>]\n"
+            "pfw-benchmark --config <directory> [--min-time <seconds>] "
+            "[--filter <benchmark name part>]\n"
+            "Print the mean time of each benchmark on stdout as JSON.\n"
+            "--config benchmarks a configuration written by scaleGenerator in the directory "
+            "instead of the built-in one.\n"
+            "--latency, --byte-cost and --batch synchronize the parameter blocks of the built-in "
+            "configuration through the benchmark-subsystem, simulating a fixed cost per "
+            "transaction, a cost per byte and transactions of several synchronizations."
+         << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    Sizes sizes;
+    Hardware hardware;
+    double minTime = 0.2;
+    string filter;
+    string generated;
+
+    for (int index = 1; index < argc; index++) {
+
+        string option = argv[index];
+        if (option == "-h" || option == "--help") {
+            showUsage();
+            return 0;
+        }
+        if (index + 1 == argc) {
+            showUsage();
+            return 1;
+        }
+        string argument = argv[++index];
+        bool bValid;
+
+        if (option == "--domains") {
+            bValid = convertTo(argument, sizes.domains) && sizes.domains != 0;
+        } else if (option == "--configurations") {
+            // At least two configurations are needed to switch between them
+            bValid = convertTo(argument, sizes.configurations) && sizes.configurations >= 2;
+        } else if (option == "--parameters") {
+            bValid = convertTo(argument, sizes.parameters) && sizes.parameters != 0;
+        } else if (option == "--array-length") {
+            bValid = convertTo(argument, sizes.arrayLength) && sizes.arrayLength != 0;
+        } else if (option == "--latency") {
+            bValid = convertTo(argument, hardware.latency);
+            hardware.bSimulated = true;
+        } else if (option == "--byte-cost") {
+            bValid = convertTo(argument, hardware.byteCost);
+            hardware.bSimulated = true;
+        } else if (option == "--batch") {
+            bValid = convertTo(argument, hardware.batch) && hardware.batch != 0;
+            hardware.bSimulated = true;
+        } else if (option == "--min-time") {
+            bValid = convertTo(argument, minTime) && minTime > 0;
+        } else if (option == "--filter") {
+            filter = argument;
+            bValid = true;
+        } else if (option == "--config") {
+            generated = argument;
+            bValid = true;
+        } else {
+            bValid = false;
+        }
+        if (!bValid) {
+            cerr << "Invalid option or argument: " << option << " " << argument << endl;
+            showUsage();
+            return 1;
+        }
+    }
+
+    Runner runner(minTime, filter);
+    string context;
+    try {
+        if (generated.empty()) {
+            runBenchmarks(runner, sizes, hardware);
+            context = "{\"domains\":" + to_string(sizes.domains) + ",\"configurations\":" +
+                      to_string(sizes.configurations) + ",\"parameters\":" +
+                      to_string(sizes.parameters) + ",\"array_length\":" +
+                      to_string(sizes.arrayLength);
+            if (hardware.bSimulated) {
+                context += ",\"hardware\":" + describeHardware(hardware);
+            }
+            context += "}";
+        } else {
+            runEngineBenchmarks(runner, generated + "/ParameterFrameworkConfiguration.xml",
+                                readCriteria(generated + "/criteria.txt"));
+            context = "{\"config\":" + utility::asJsonString(generated) + "}";
+        }
+    } catch (std::exception &e) {
+        cerr << "pfw-benchmark error: " << e.what() << endl;
+        return 1;
+    }
+    runner.write(cout, context);
+    return 0;
+}
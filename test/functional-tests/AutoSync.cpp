@@ -28,8 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "Config.hpp"
-#include "ParameterFramework.hpp"
+#include "BoolPF.hpp"
 #include <SubsystemObject.h>
 #include <IntrospectionEntryPoint.h>
 #include "Test.hpp"
@@ -41,50 +40,6 @@ using std::string;
 namespace parameterFramework
 {
 
-struct BoolPF : public ParameterFramework
-{
-    BoolPF() : ParameterFramework{createConfig()} {}
-
-    /** Set the boolean parameter value within the "Conf" configuration,
-     * which is always applicable. */
-    void setParameterValue(bool value)
-    {
-        std::string valueStr = value ? "1" : "0";
-        setConfigurationParameter("Domain", "Conf", "/test/test/param", valueStr);
-    }
-
-private:
-    static Config createConfig()
-    {
-        Config config;
-        config.instances = R"(<BooleanParameter Name="param" Mapping="Object"/>)";
-        config.plugins = {{"", {"introspection-subsystem"}}};
-        config.subsystemType = "INTROSPECTION";
-
-        config.domains = R"(<ConfigurableDomain Name="Domain">
-                                <Configurations>
-                                    <Configuration Name="Conf">
-                                        <CompoundRule Type="All"/>
-                                    </Configuration>
-                                </Configurations>
-
-                                <ConfigurableElements>
-                                    <ConfigurableElement Path="/test/test/param"/>
-                                </ConfigurableElements>
-
-                                <Settings>
-                                    <Configuration Name="Conf">
-                                        <ConfigurableElement Path="/test/test/param">
-                                            <BooleanParameter Name="param">0</BooleanParameter>
-                                        </ConfigurableElement>
-                                    </Configuration>
-                                </Settings>
-                            </ConfigurableDomain>)";
-
-        return config;
-    }
-};
-
 SCENARIO_METHOD(BoolPF, "Auto sync")
 {
     GIVEN ("A Pfw that starts") {
@@ -36,6 +36,8 @@
 #include <catch.hpp>
 
 #include <list>
+#include <memory>
+#include <sstream>
 #include <string>
 
 #include <cstdio>
@@ -98,6 +100,91 @@ SCENARIO("Logger should receive info and warnings", "[log]")
     }
 }
 
+SCENARIO("Logger should only receive logs of enabled levels", "[log]")
+{
+    GIVEN ("A logger that stores logs") {
+        StoreLogger logger{};
+        GIVEN ("A parameter framework with config files that emit warnings") {
+            WarningPF pfw;
+            pfw.setLogger(&logger);
+            using Level = StoreLogger::Log::Level;
+            using LogLevel = CParameterMgrPlatformConnector::LogLevel;
+            THEN ("The default log level should be info") {
+                CHECK(pfw.getLogLevel() == LogLevel::info);
+            }
+            WHEN ("The log level is set to warning") {
+                pfw.setLogLevel(LogLevel::warning);
+                CHECK(pfw.getLogLevel() == LogLevel::warning);
+                REQUIRE_NOTHROW(pfw.start());
+                THEN ("Only warnings should have been logged") {
+                    CHECK(logger.filter(Level::warning) != StoreLogger::Logs{});
+                    CHECK(logger.filter(Level::info) == StoreLogger::Logs{});
+                }
+                AND_WHEN ("The log level is set back to info") {
+                    pfw.setLogLevel(LogLevel::info);
+                    pfw.applyConfigurations();
+                    THEN ("Infos should be logged again") {
+                        CHECK(logger.filter(Level::info) != StoreLogger::Logs{});
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Asynchronous logger should receive all logs", "[log]")
+{
+    GIVEN ("A logger that stores logs") {
+        StoreLogger logger{};
+        GIVEN ("A parameter framework with config files that emit warnings") {
+            std::unique_ptr<WarningPF> pfw(new WarningPF);
+            pfw->setLogger(&logger);
+            WHEN ("Asynchronous logging is enabled") {
+                REQUIRE_NOTHROW(pfw->setAsynchronousLogging(true));
+                CHECK(pfw->getAsynchronousLogging());
+                REQUIRE_NOTHROW(pfw->start());
+                THEN ("The policy can not be changed while running") {
+                    REQUIRE_THROWS_AS(pfw->setAsynchronousLogging(false), Exception);
+                }
+                AND_WHEN ("The logger is replaced then cleared while running") {
+                    std::unique_ptr<StoreLogger> other(new StoreLogger);
+                    pfw->setLogger(other.get());
+                    auto startLogs = logger.getLogs();
+                    THEN ("The pending logs should have been forwarded to the previous logger") {
+                        CHECK(logger.filter(StoreLogger::Log::Level::warning) !=
+                              StoreLogger::Logs{});
+                    }
+                    pfw->applyConfigurations();
+                    pfw->setLogger(nullptr);
+                    auto otherLogs = other->getLogs();
+                    // The client may destroy its logger once detached
+                    other.reset();
+                    pfw->applyConfigurations();
+                    pfw.reset();
+                    THEN ("Each logger should only have received the logs of its time") {
+                        CHECK(logger.getLogs() == startLogs);
+                        if (otherLogs.size() > 0) {
+                            CHECK(otherLogs.back().msg == "}");
+                        }
+                    }
+                }
+                AND_WHEN ("The parameter framework is destroyed") {
+                    pfw->applyConfigurations();
+                    auto dropped = pfw->getDroppedLogCount();
+                    pfw.reset();
+                    THEN ("The pending logs should have been forwarded") {
+                        CHECK(logger.filter(StoreLogger::Log::Level::warning) !=
+                              StoreLogger::Logs{});
+                        if (dropped == 0) {
+                            CHECK(logger.getLogs().back().msg == "}");
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 SCENARIO_METHOD(LazyPF, "Tuning OK", "[properties][remote interface]")
 {
 }
@@ -168,6 +255,41 @@ SCENARIO_METHOD(LazyPF, "Invalid domains", "[properties]")
     }
 }
 
+SCENARIO_METHOD(LazyPF, "Startup profile", "[properties][profile]")
+{
+    GIVEN ("A valid configuration") {
+        create({});
+        WHEN ("The Pfw starts") {
+            REQUIRE_NOTHROW(mPf->start());
+            THEN ("Each start phase should have been profiled") {
+                std::ostringstream profile;
+                mPf->writeStartupProfile(profile);
+                INFO(profile.str());
+                for (auto &phase : {"framework configuration", "subsystem plugins", "structure",
+                                    "settings", "init", "back synchronization", "validation",
+                                    "initial application", "remote interface", "total"}) {
+                    CAPTURE(phase);
+                    CHECK(profile.str().find("    " + std::string(phase) + " ") !=
+                          std::string::npos);
+                }
+            }
+        }
+    }
+    GIVEN ("An invalid structure") {
+        create({&Config::instances, "<unknown_tag/>"});
+        WHEN ("The Pfw fails to start") {
+            REQUIRE_THROWS_AS(mPf->start(), Exception);
+            THEN ("The profile should stop at the failing phase") {
+                std::ostringstream profile;
+                mPf->writeStartupProfile(profile);
+                INFO(profile.str());
+                CHECK(profile.str().find("    structure ") != std::string::npos);
+                CHECK(profile.str().find("    settings ") == std::string::npos);
+            }
+        }
+    }
+}
+
 SCENARIO_METHOD(ParameterFramework, "Raw value space")
 {
     WHEN ("Raw value space is set") {
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "BenchmarkEntryPoint.h"
+#include "Test.hpp"
+#include <catch.hpp>
+
+#include <string>
+
+namespace parameterFramework
+{
+
+using benchmarkSubsystem::getCallCounts;
+
+struct BenchmarkPF : public ParameterFramework
+{
+    BenchmarkPF() : ParameterFramework{createConfig()} {}
+
+private:
+    static Config createConfig()
+    {
+        Config config;
+        config.subsystemMapping = "Batch:2";
+        config.instances = R"(<BooleanParameter Name="first" Mapping="Object"/>
+                              <BooleanParameter Name="second" Mapping="Object"/>
+                              <ParameterBlock Name="block" Mapping="FailureRate:50">
+                                  <IntegerParameter Name="failing" Size="16" Mapping="Object"/>
+                              </ParameterBlock>)";
+        config.plugins = {{"", {"benchmark-subsystem"}}};
+        config.subsystemType = "BENCHMARK";
+        return config;
+    }
+};
+
+SCENARIO_METHOD(BenchmarkPF, "Benchmark subsystem", "[benchmark subsystem]")
+{
+    benchmarkSubsystem::resetCallCounts();
+
+    GIVEN ("A started Pfw") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Each object should have been received once") {
+            auto counts = getCallCounts();
+            REQUIRE(counts.size() == 3);
+            CHECK(counts["/test/test/first"].receives == 1);
+            CHECK(counts["/test/test/first"].sends == 0);
+            CHECK(counts["/test/test/first"].bytes == 1);
+            CHECK(counts["/test/test/block/failing"].bytes == 2);
+        }
+        THEN ("Consecutive calls should share transactions") {
+            auto counts = getCallCounts();
+            CHECK(counts["/test/test/first"].transactions +
+                      counts["/test/test/second"].transactions +
+                      counts["/test/test/block/failing"].transactions ==
+                  2);
+        }
+        WHEN ("Parameters are written in tuning mode") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            std::string value = "1";
+            REQUIRE_NOTHROW(setParameter("/test/test/first", value));
+            THEN ("They should have been sent") {
+                auto counts = getCallCounts();
+                CHECK(counts["/test/test/first"].sends == 1);
+                CHECK(counts["/test/test/first"].failures == 0);
+            }
+            THEN ("Every other call of an object with a 50% failure rate should fail") {
+                REQUIRE_THROWS_AS(setParameter("/test/test/block/failing", value), Exception);
+                REQUIRE_NOTHROW(setParameter("/test/test/block/failing", value));
+                CHECK(getCallCounts()["/test/test/block/failing"].failures == 1);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ScaleGenerator.hpp"
+#include "CriterionReplay.hpp"
+#include "TmpFile.hpp"
+#include "CriterionTrace.h"
+#include "ParameterMgrFullConnector.h"
+#include "SelectionCriterionInterface.h"
+#include "SelectionCriterionTypeInterface.h"
+#include <catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace parameterFramework
+{
+
+/** @return the configurations applied in after but not in before */
+static std::vector<std::string> getChanges(const std::vector<std::string> &before,
+                                           const std::vector<std::string> &after)
+{
+    std::vector<std::string> changes;
+    for (auto &configuration : after) {
+        if (std::find(before.begin(), before.end(), configuration) == before.end()) {
+            changes.push_back(configuration);
+        }
+    }
+    return changes;
+}
+
+SCENARIO("Criterion recording", "[criterionTrace]")
+{
+    scaleGenerator::Sizes sizes;
+    sizes.subsystems = 1;
+    sizes.criteria = 2;
+    sizes.domains = 2;
+    scaleGenerator::ScaleGenerator generator(sizes);
+    std::string error;
+    REQUIRE(generator.validate(error));
+
+    utility::TmpFile structure(generator.getStructure());
+    utility::TmpFile domains(generator.getDomains());
+    utility::TmpFile topLevel(generator.getTopLevel(structure.getPath(), domains.getPath()));
+    CParameterMgrFullConnector pfw(topLevel.getPath());
+    pfw.setLogger(nullptr);
+    pfw.setForceNoRemoteInterface(true);
+
+    std::vector<ISelectionCriterionInterface *> criteria;
+    for (auto &criterion : generator.getCriteria()) {
+        auto type = pfw.createSelectionCriterionType(false);
+        for (size_t state = 0; state < criterion.states.size(); state++) {
+            REQUIRE(type->addValuePair(static_cast<int>(state), criterion.states[state], error));
+        }
+        criteria.push_back(pfw.createSelectionCriterion(criterion.name, type));
+    }
+    criteria[1]->setCriterionState(2);
+
+    // Only the path is needed, the trace is written by the parameter framework
+    utility::TmpFile trace("");
+
+    GIVEN ("A parameter framework not yet started") {
+        THEN ("Recording should fail") {
+            CHECK_FALSE(pfw.startCriterionRecording(trace.getPath(), error));
+        }
+    }
+    GIVEN ("A started parameter framework") {
+        INFO(error);
+        REQUIRE(pfw.start(error));
+
+        THEN ("Recording to an invalid path should fail") {
+            CHECK_FALSE(pfw.startCriterionRecording("/not/a/directory/trace", error));
+        }
+        THEN ("Every domain should have applied a configuration") {
+            CHECK(pfw.getAppliedConfigurations().size() == sizes.domains);
+        }
+        WHEN ("Criterion changes and applications are recorded") {
+            auto initial = pfw.getAppliedConfigurations();
+            REQUIRE(pfw.startCriterionRecording(trace.getPath(), error));
+            criteria[0]->setCriterionState(1);
+            // Setting the current state is not a change
+            criteria[0]->setCriterionState(1);
+            pfw.applyConfigurations();
+            auto first = pfw.getAppliedConfigurations();
+            criteria[1]->setCriterionState(3);
+            pfw.applyConfigurations();
+            auto second = pfw.getAppliedConfigurations();
+            pfw.stopCriterionRecording();
+
+            // Not recorded any more
+            criteria[1]->setCriterionState(0);
+            pfw.applyConfigurations();
+
+            ::utility::criterionTrace::Reader reader;
+            REQUIRE(reader.read(trace.getPath(), error));
+
+            THEN ("The criteria should be defined with their state at the recording start") {
+                auto &definitions = reader.getDefinitions();
+                REQUIRE(definitions.size() == 2);
+                CHECK(definitions[0].name == "criterion0");
+                CHECK_FALSE(definitions[0].bInclusive);
+                CHECK(definitions[0].valuePairs.size() == sizes.criterionStates);
+                CHECK(definitions[0].state == 0);
+                CHECK(definitions[1].name == "criterion1");
+                CHECK(definitions[1].state == 2);
+            }
+            THEN ("The changes and applications should be recorded in order") {
+                auto &events = reader.getEvents();
+                REQUIRE(events.size() == 4);
+                CHECK_FALSE(events[0].bApply);
+                CHECK(events[0].criterion == 0);
+                CHECK(events[0].state == 1);
+                CHECK(events[1].bApply);
+                CHECK_FALSE(events[2].bApply);
+                CHECK(events[2].criterion == 1);
+                CHECK(events[2].state == 3);
+                CHECK(events[3].bApply);
+                for (size_t event = 1; event < events.size(); event++) {
+                    CHECK(events[event - 1].time <= events[event].time);
+                }
+            }
+            THEN ("Replaying them should apply the same configurations") {
+                std::vector<criterionReplay::Application> applications;
+                REQUIRE(criterionReplay::replay(topLevel.getPath(), reader, false, applications,
+                                                error));
+                REQUIRE(applications.size() == 2);
+                CHECK(applications[0].time == reader.getEvents()[1].time);
+                CHECK(applications[0].changes == getChanges(initial, first));
+                CHECK(applications[1].changes == getChanges(first, second));
+                CHECK_FALSE(applications[0].changes.empty());
+            }
+        }
+    }
+}
+} // namespace parameterFramework
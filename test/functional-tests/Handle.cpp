@@ -43,6 +43,8 @@
 
 #include <string>
 #include <list>
+#include <algorithm>
+#include <iterator>
 
 #include <stdlib.h>
 
@@ -500,6 +502,45 @@ SCENARIO_METHOD(SettingsTestPF, "Export and import array binary settings",
     }
 }
 
+SCENARIO_METHOD(SettingsTestPF, "Raw binary settings of several elements through commands",
+                "[handler][settings][bytes]")
+{
+    auto cmdHandler = std::unique_ptr<CommandHandlerInterface>(createCommandHandler());
+    string elem0 = "/test/test/parameter_block_array/0";
+    string elem1 = "/test/test/parameter_block_array/1";
+    ElementHandle array(*this, "/test/test/parameter_block_array");
+
+    auto asString = [](const Bytes &bytes) { return string(begin(bytes), end(bytes)); };
+    auto asBytes = [](const string &bytes) { return Bytes(begin(bytes), end(bytes)); };
+
+    WHEN ("Getting the raw settings of several elements") {
+        string output;
+        REQUIRE(cmdHandler->process("getElementsRawBytes", {elem1, "/test/test/parameter_block"},
+                                    output));
+        THEN ("They should be concatenated in order") {
+            checkBytesEq(asBytes(output), defaultBasicSettingsBytes + defaultBasicSettingsBytes);
+        }
+    }
+    WHEN ("Setting the raw settings of several elements") {
+        REQUIRE_NOTHROW(setTuningMode(true));
+        string bytes = asString(readBytes(testBasicSettingsBytes + defaultBasicSettingsBytes));
+        string output;
+        REQUIRE(cmdHandler->process("setElementsRawBytes", {elem1, elem0, bytes}, output));
+        THEN ("Each element should have its own settings") {
+            checkBytesEq(array.getAsBytes(), defaultBasicSettingsBytes + testBasicSettingsBytes);
+        }
+    }
+    WHEN ("Setting raw settings of the wrong size") {
+        REQUIRE_NOTHROW(setTuningMode(true));
+        string bytes = asString(readBytes(testBasicSettingsBytes));
+        string output;
+        CHECK_FALSE(cmdHandler->process("setElementsRawBytes", {elem1, elem0, bytes}, output));
+        THEN ("No element should have changed") {
+            checkBytesEq(array.getAsBytes(), defaultBasicSettingsBytes + defaultBasicSettingsBytes);
+        }
+    }
+}
+
 SCENARIO_METHOD(SettingsTestPF, "Import root in one format, export in an other",
                 "[handler][settings][bytes][xml]")
 {
@@ -662,4 +703,73 @@ SCENARIO_METHOD(SettingsTestPF, "Handle Get/Set as various kinds", "[handler][dy
         }
     }
 }
+SCENARIO_METHOD(SettingsTestPF, "Handle Get/Set arrays through buffers", "[handler][dynamic]")
+{
+    ElementHandle intArray(*this, "/test/test/parameter_block/integer_array");
+    WHEN ("Setting a signed integer array from a buffer") {
+        const int32_t expected[] = {-9, 8, -7, 6};
+        CHECK_NOTHROW(intArray.setAsSignedIntegerBuffer(expected, 4));
+        THEN ("Getting it back as a buffer should give the same values") {
+            int32_t back[] = {-42, 42, 43, -43};
+            CHECK_NOTHROW(intArray.getAsSignedIntegerBuffer(back, 4));
+            CHECK(std::equal(std::begin(back), std::end(back), std::begin(expected)));
+        }
+        THEN ("Getting it back as a vector should give the same values") {
+            std::vector<int32_t> back;
+            CHECK_NOTHROW(intArray.getAsSignedIntegerArray(back));
+            CHECK(back == std::vector<int32_t>(std::begin(expected), std::end(expected)));
+        }
+        THEN ("Getting it back as unsigned should give the raw values") {
+            uint32_t back[4];
+            CHECK_NOTHROW(intArray.getAsIntegerBuffer(back, 4));
+            CHECK(back[0] == static_cast<uint32_t>(-9));
+            CHECK(back[1] == 8);
+        }
+    }
+    WHEN ("Setting a buffer with one out of range value") {
+        const int32_t invalid[] = {1, 2, 3, 11};
+        CHECK_THROWS_AS(intArray.setAsSignedIntegerBuffer(invalid, 4), Exception);
+        THEN ("No value should have been written") {
+            std::vector<int32_t> back;
+            CHECK_NOTHROW(intArray.getAsSignedIntegerArray(back));
+            CHECK(back == (std::vector<int32_t>{-10, -10, -10, -10}));
+        }
+    }
+    WHEN ("Accessing with a buffer length mismatch") {
+        int32_t buffer[3] = {0, 0, 0};
+        THEN ("It should fail") {
+            CHECK_THROWS_AS(intArray.setAsSignedIntegerBuffer(buffer, 3), Exception);
+            CHECK_THROWS_AS(intArray.getAsSignedIntegerBuffer(buffer, 3), Exception);
+        }
+    }
+
+    ElementHandle fixedPointArray(*this, "/test/test/parameter_block/fix_point_array");
+    WHEN ("Setting a fixed point array from a buffer") {
+        const double expected[] = {7.125, 0.6875, -1};
+        CHECK_NOTHROW(fixedPointArray.setAsDoubleBuffer(expected, 3));
+        THEN ("Getting it back should give the same values") {
+            double back[3];
+            CHECK_NOTHROW(fixedPointArray.getAsDoubleBuffer(back, 3));
+            CHECK(std::equal(std::begin(back), std::end(back), std::begin(expected)));
+        }
+        THEN ("The settings should be the ones set through the buffer") {
+            string value;
+            getParameter("/test/test/parameter_block/fix_point_array", value);
+            CHECK(value == "7.1250 0.6875 -1.0000");
+        }
+    }
+    WHEN ("Setting a fixed point array with an out of range value") {
+        const double invalid[] = {1, 2, 8};
+        CHECK_THROWS_AS(fixedPointArray.setAsDoubleBuffer(invalid, 3), Exception);
+    }
+
+    ElementHandle intScalar(*this, "/test/test/parameter_block/integer");
+    WHEN ("Accessing a scalar through a buffer") {
+        uint32_t buffer[1] = {50};
+        THEN ("It should fail") {
+            CHECK_THROWS_AS(intScalar.setAsIntegerBuffer(buffer, 1), Exception);
+            CHECK_THROWS_AS(intScalar.getAsIntegerBuffer(buffer, 1), Exception);
+        }
+    }
+}
 } // namespace parameterFramework
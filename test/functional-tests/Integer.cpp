@@ -36,9 +36,13 @@
 
 #include <catch.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <vector>
 
 using std::string;
+using std::vector;
 
 namespace parameterFramework
 {
@@ -157,4 +161,101 @@ SCENARIO_METHOD(IntegerPF, "Integer types", "[Integer types]")
         }
     }
 }
+
+const auto adaptedIntegerArrays = Config{
+    &Config::instances,
+    R"(<IntegerParameter Name="linear" Size="16" Signed="true" Min="-1000" Max="1000"
+                         ArrayLength="300">
+        <LinearAdaptation SlopeNumerator="10" SlopeDenominator="3" Offset="5"/>
+    </IntegerParameter>
+    <IntegerParameter Name="gain" Size="8" Signed="false" Max="120" ArrayLength="9">
+        <LogarithmicAdaptation LogarithmBase="10" SlopeNumerator="20" Offset="100"
+                               FloorValue="0"/>
+    </IntegerParameter>
+    <IntegerParameter Name="wideGain" Size="32" Signed="true" ArrayLength="7">
+        <LogarithmicAdaptation SlopeNumerator="1000" FloorValue="-100000"/>
+    </IntegerParameter>)"};
+
+struct AdaptedIntegerPF : public ParameterFramework
+{
+    AdaptedIntegerPF() : ParameterFramework{std::move(adaptedIntegerArrays)} {}
+};
+
+SCENARIO_METHOD(AdaptedIntegerPF, "Adapted integer arrays", "[Integer types]")
+{
+    REQUIRE_NOTHROW(start());
+
+    GIVEN ("A linear adaptation on an array larger than a conversion chunk") {
+        ElementHandle handle{*this, "/test/test/linear"};
+        vector<double> values(300);
+        vector<int32_t> expected(values.size());
+        for (size_t index = 0; index < values.size(); ++index) {
+            values[index] = static_cast<double>(index) * 0.7 - 100;
+            expected[index] = static_cast<int32_t>(values[index] * 10 / 3) + 5;
+        }
+        REQUIRE_NOTHROW(handle.setAsDoubleArray(values));
+
+        THEN ("Each value is adapted as a single one would be") {
+            vector<int32_t> raw;
+            REQUIRE_NOTHROW(handle.getAsSignedIntegerArray(raw));
+            CHECK(raw == expected);
+
+            vector<double> userValues;
+            REQUIRE_NOTHROW(handle.getAsDoubleArray(userValues));
+            for (size_t index = 0; index < values.size(); ++index) {
+                CHECK(userValues[index] == (expected[index] - 5) * 3 / 10.);
+            }
+        }
+        WHEN ("A value in the second chunk is out of range") {
+            values.back() = 400;
+            CHECK_THROWS_AS(handle.setAsDoubleArray(values), Exception);
+
+            THEN ("No value is written") {
+                vector<int32_t> raw;
+                REQUIRE_NOTHROW(handle.getAsSignedIntegerArray(raw));
+                CHECK(raw == expected);
+            }
+        }
+    }
+    GIVEN ("A logarithmic adaptation on a small range") {
+        ElementHandle handle{*this, "/test/test/gain"};
+        const vector<double> values = {1, 0.002, 1e-6, 0, -1, 10, 11, 0.5, 2};
+        REQUIRE_NOTHROW(handle.setAsDoubleArray(values));
+
+        THEN ("Values are adapted and floored") {
+            vector<uint32_t> raw;
+            REQUIRE_NOTHROW(handle.getAsIntegerArray(raw));
+            CHECK(raw == (vector<uint32_t>{100, 47, 0, 0, 0, 120, 120, 94, 106}));
+
+            vector<double> userValues;
+            REQUIRE_NOTHROW(handle.getAsDoubleArray(userValues));
+            for (size_t index = 0; index < raw.size(); ++index) {
+                CHECK(userValues[index] == Approx(std::pow(10, (raw[index] - 100.) / 20)));
+            }
+        }
+        WHEN ("A value is out of range") {
+            CHECK_THROWS_AS(handle.setAsDoubleArray(vector<double>(9, 100)), Exception);
+        }
+    }
+    GIVEN ("A logarithmic adaptation on a wide range") {
+        ElementHandle handle{*this, "/test/test/wideGain"};
+        const vector<double> values = {1, 0.5, 1e-50, 0, 3, 1e6, 0.1};
+        REQUIRE_NOTHROW(handle.setAsDoubleArray(values));
+
+        THEN ("Values are adapted and floored") {
+            vector<int32_t> raw;
+            REQUIRE_NOTHROW(handle.getAsSignedIntegerArray(raw));
+            for (size_t index = 0; index < values.size(); ++index) {
+                double adapted = std::trunc(std::log(values[index]) * 1000);
+                CHECK(raw[index] == static_cast<int32_t>(std::max(adapted, -100000.)));
+            }
+
+            vector<double> userValues;
+            REQUIRE_NOTHROW(handle.getAsDoubleArray(userValues));
+            for (size_t index = 0; index < raw.size(); ++index) {
+                CHECK(userValues[index] == Approx(std::exp(raw[index] / 1000.)));
+            }
+        }
+    }
+}
 }
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BoolPF.hpp"
+#include "ElementHandle.hpp"
+#include "Test.hpp"
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+namespace parameterFramework
+{
+
+struct MetricsPF : public BoolPF
+{
+    MetricsPF() : BoolPF{true} {}
+
+    std::string getMetrics(bool bJson)
+    {
+        std::ostringstream metrics;
+        writeMetrics(metrics, bJson);
+        return metrics.str();
+    }
+};
+
+SCENARIO_METHOD(MetricsPF, "Runtime metrics", "[metrics]")
+{
+    GIVEN ("A started Pfw") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("The initial configuration application should have been counted") {
+            auto json = getMetrics(true);
+            INFO(json);
+            CHECK(json.find("{\"counters\":{\"applies\":1,\"domains_evaluated\":1,"
+                            "\"configurations_switched\":1,\"bytes_restored\":1}") == 0);
+            CHECK(json.find("\"apply\":{\"count\":1,") != std::string::npos);
+            CHECK(json.find("\"syncs\":{\"test\":{\"issued\":1,\"failed\":0}}") !=
+                  std::string::npos);
+        }
+        THEN ("The metrics should be printable as text") {
+            auto text = getMetrics(false);
+            INFO(text);
+            CHECK(text.find("Applies: 1\n") == 0);
+            CHECK(text.find("    test: 1 0\n") != std::string::npos);
+        }
+        WHEN ("Configurations are applied again") {
+            applyConfigurations();
+            THEN ("The domain should have been evaluated but no configuration switched") {
+                auto json = getMetrics(true);
+                INFO(json);
+                CHECK(json.find("{\"counters\":{\"applies\":2,\"domains_evaluated\":2,"
+                                "\"configurations_switched\":1,") == 0);
+            }
+        }
+        WHEN ("A parameter is read through a handle") {
+            ElementHandle handle{*this, "/test/test/param"};
+            bool value;
+            handle.getAsBoolean(value);
+            THEN ("The access latency should have been recorded") {
+                auto json = getMetrics(true);
+                INFO(json);
+                CHECK(json.find("\"get\":{\"count\":1,") != std::string::npos);
+                CHECK(json.find("\"set\":{\"count\":0,") != std::string::npos);
+            }
+        }
+        WHEN ("The metrics are reset") {
+            resetMetrics();
+            THEN ("All metrics should be null") {
+                auto json = getMetrics(true);
+                INFO(json);
+                CHECK(json.find("{\"counters\":{\"applies\":0,\"domains_evaluated\":0,"
+                                "\"configurations_switched\":0,\"bytes_restored\":0}") == 0);
+                CHECK(json.find("\"syncs\":{}") != std::string::npos);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
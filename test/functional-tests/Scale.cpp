@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ScaleGenerator.hpp"
+#include "TmpFile.hpp"
+#include "ParameterMgrFullConnector.h"
+#include "ElementHandle.h"
+#include "SelectionCriterionInterface.h"
+#include "SelectionCriterionTypeInterface.h"
+#include <catch.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace parameterFramework
+{
+
+/** Configuration files written by the scale generator */
+struct ScaleFiles
+{
+    ScaleFiles(const scaleGenerator::ScaleGenerator &generator)
+        : structure(generator.getStructure()), domains(generator.getDomains()),
+          topLevel(generator.getTopLevel(structure.getPath(), domains.getPath()))
+    {
+    }
+
+    utility::TmpFile structure;
+    utility::TmpFile domains;
+    utility::TmpFile topLevel;
+};
+
+SCENARIO("Generated large configuration", "[scale]")
+{
+    scaleGenerator::Sizes sizes;
+    sizes.arrayLength = 4;
+    scaleGenerator::ScaleGenerator generator(sizes);
+    std::string error;
+    REQUIRE(generator.validate(error));
+
+    ScaleFiles files(generator);
+    CParameterMgrFullConnector pfw(files.topLevel.getPath());
+    pfw.setLogger(nullptr);
+    pfw.setForceNoRemoteInterface(true);
+
+    std::map<std::string, ISelectionCriterionInterface *> criteria;
+    for (auto &criterion : generator.getCriteria()) {
+        auto type = pfw.createSelectionCriterionType(false);
+        for (size_t state = 0; state < criterion.states.size(); state++) {
+            REQUIRE(type->addValuePair(static_cast<int>(state), criterion.states[state], error));
+        }
+        criteria[criterion.name] = pfw.createSelectionCriterion(criterion.name, type);
+    }
+
+    GIVEN ("A parameter framework started on the generated configuration") {
+        INFO(error);
+        REQUIRE(pfw.start(error));
+
+        std::unique_ptr<ElementHandle> param(
+            pfw.createElementHandle("/Scale/subsystem0/component0/param1", error));
+        REQUIRE(param != nullptr);
+        // param1 is set to c + 1 by configuration c of the domain of component0
+        uint32_t value;
+
+        THEN ("All domains should have been loaded") {
+            std::string xml;
+            REQUIRE(pfw.exportDomainsXml(xml, false, false, error));
+            for (size_t domain = 0; domain < sizes.domains; domain++) {
+                CAPTURE(domain);
+                CHECK(xml.find("Name=\"domain" + std::to_string(domain) + "\"") !=
+                      std::string::npos);
+            }
+        }
+        THEN ("The default configurations should be applied") {
+            REQUIRE(param->getAsInteger(value, error));
+            CHECK(value == sizes.configurationsPerDomain - 1 + 1);
+        }
+        WHEN ("The criteria match the top level rule of a configuration") {
+            criteria["criterion0"]->setCriterionState(1);
+            criteria["criterion1"]->setCriterionState(2);
+            pfw.applyConfigurations();
+            THEN ("This configuration should be applied") {
+                REQUIRE(param->getAsInteger(value, error));
+                CHECK(value == 1 + 1);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "SelectionCriterionInterface.h"
+#include "SelectionCriterionTypeInterface.h"
+#include <IntrospectionEntryPoint.h>
+#include "Test.hpp"
+#include <catch.hpp>
+
+#include <map>
+#include <string>
+
+namespace parameterFramework
+{
+
+/** Two domains: "Switched" holds "first" and "second" and follows the "Mode" criterion,
+ * "Fixed" holds "third" and has a single configuration. */
+struct SyncPF : public ParameterFramework
+{
+    SyncPF() : ParameterFramework{createConfig()}
+    {
+        std::string error;
+        auto type = createSelectionCriterionType(false);
+        REQUIRE(type->addValuePair(0, "off", error));
+        REQUIRE(type->addValuePair(1, "on", error));
+        mode = createSelectionCriterion("Mode", type);
+    }
+
+    /** @return the synchronizations recorded since the last reset, by object path */
+    static std::map<std::string, size_t> getSyncCounts()
+    {
+        std::map<std::string, size_t> counts;
+        for (auto &sync : introspectionSubsystem::getSyncs()) {
+            counts[sync.path]++;
+        }
+        return counts;
+    }
+
+    ISelectionCriterionInterface *mode;
+
+private:
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<BooleanParameter Name="first" Mapping="Object"/>
+                              <BooleanParameter Name="second" Mapping="Object"/>
+                              <BooleanParameter Name="third" Mapping="Object"/>)";
+        config.plugins = {{"", {"introspection-subsystem"}}};
+        config.subsystemType = "INTROSPECTION";
+
+        config.domains = R"(<ConfigurableDomain Name="Switched">
+                                <Configurations>
+                                    <Configuration Name="On">
+                                        <CompoundRule Type="All">
+                                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                                    MatchesWhen="Is" Value="on"/>
+                                        </CompoundRule>
+                                    </Configuration>
+                                    <Configuration Name="Off">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/first"/>
+                                    <ConfigurableElement Path="/test/test/second"/>
+                                </ConfigurableElements>
+
+                                <Settings>
+                                    <Configuration Name="On">
+                                        <ConfigurableElement Path="/test/test/first">
+                                            <BooleanParameter Name="first">1</BooleanParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/second">
+                                            <BooleanParameter Name="second">1</BooleanParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                    <Configuration Name="Off">
+                                        <ConfigurableElement Path="/test/test/first">
+                                            <BooleanParameter Name="first">0</BooleanParameter>
+                                        </ConfigurableElement>
+                                        <ConfigurableElement Path="/test/test/second">
+                                            <BooleanParameter Name="second">0</BooleanParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>
+                            <ConfigurableDomain Name="Fixed">
+                                <Configurations>
+                                    <Configuration Name="Default">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/third"/>
+                                </ConfigurableElements>
+
+                                <Settings>
+                                    <Configuration Name="Default">
+                                        <ConfigurableElement Path="/test/test/third">
+                                            <BooleanParameter Name="third">1</BooleanParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+
+        return config;
+    }
+};
+
+SCENARIO_METHOD(SyncPF, "Synchronization count", "[sync]")
+{
+    GIVEN ("A started Pfw") {
+        introspectionSubsystem::resetSyncs();
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Each object should have been written once") {
+            // Objects in domains are not read back: their value comes from the settings
+            auto syncs = introspectionSubsystem::getSyncs();
+            CHECK(syncs.size() == 3);
+            for (auto &sync : syncs) {
+                CHECK_FALSE(sync.bReceive);
+            }
+            auto counts = getSyncCounts();
+            CHECK(counts["/test/test/first"] == 1);
+            CHECK(counts["/test/test/second"] == 1);
+            CHECK(counts["/test/test/third"] == 1);
+        }
+
+        introspectionSubsystem::resetSyncs();
+
+        WHEN ("Configurations are applied while the criteria are unchanged") {
+            applyConfigurations();
+            THEN ("No object should be synchronized") {
+                CHECK(introspectionSubsystem::getSyncs().empty());
+            }
+        }
+        WHEN ("A criterion change switches the configuration of a domain") {
+            mode->setCriterionState(1);
+            applyConfigurations();
+            THEN ("Only the objects of this domain should be written, once") {
+                auto syncs = introspectionSubsystem::getSyncs();
+                CHECK(syncs.size() == 2);
+                for (auto &sync : syncs) {
+                    CHECK_FALSE(sync.bReceive);
+                }
+                auto counts = getSyncCounts();
+                CHECK(counts["/test/test/first"] == 1);
+                CHECK(counts["/test/test/second"] == 1);
+                CHECK(counts.count("/test/test/third") == 0);
+            }
+        }
+        WHEN ("A parameter is written in tuning mode") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            std::string value = "1";
+            REQUIRE_NOTHROW(setParameter("/test/test/second", value));
+            THEN ("Only this parameter should be written, once") {
+                auto syncs = introspectionSubsystem::getSyncs();
+                REQUIRE(syncs.size() == 1);
+                CHECK(syncs.front().path == "/test/test/second");
+                CHECK_FALSE(syncs.front().bReceive);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BoolPF.hpp"
+#include "Test.hpp"
+#include <catch.hpp>
+
+#include <set>
+#include <sstream>
+#include <string>
+
+namespace parameterFramework
+{
+
+/** Trace hook that stores the names and details of the traced steps. */
+struct StoreTraceHook : public CParameterMgrPlatformConnector::ITraceHook
+{
+    void span(const std::string &name, const std::string &detail, uint64_t,
+              uint64_t) override
+    {
+        names.insert(name);
+        details.insert(detail);
+    }
+    std::set<std::string> names;
+    std::set<std::string> details;
+};
+
+/** Trace hook that uses the tracing API from within the traced steps. */
+struct ReentrantTraceHook : public CParameterMgrPlatformConnector::ITraceHook
+{
+    ReentrantTraceHook(ParameterFramework &pfw) : pfw(pfw) {}
+
+    void span(const std::string &, const std::string &, uint64_t, uint64_t) override
+    {
+        std::ostringstream output;
+        pfw.writeChromeTrace(output);
+        trace = output.str();
+        pfw.setTraceHook(nullptr);
+        ++calls;
+    }
+    ParameterFramework &pfw;
+    std::string trace;
+    size_t calls = 0;
+};
+
+SCENARIO_METHOD(BoolPF, "Tracing of configuration application", "[trace]")
+{
+    StoreTraceHook hook;
+    GIVEN ("A Pfw with tracing enabled") {
+        try {
+            setTracing(true);
+        } catch (Exception &e) {
+            WARN("Tracing support is not built: " << e.what());
+            CHECK_FALSE(getTracing());
+            return;
+        }
+        CHECK(getTracing());
+        setTraceHook(&hook);
+
+        WHEN ("The Pfw starts") {
+            REQUIRE_NOTHROW(start());
+
+            THEN ("Each step of configuration application should have been traced") {
+                for (auto &name : {"applyConfigurations", "evaluate", "restore", "sync",
+                                   "sendToHW"}) {
+                    CAPTURE(name);
+                    CHECK(hook.names.count(name) == 1);
+                }
+                CHECK(hook.details.count("Domain/Conf") == 1);
+                CHECK(hook.details.count("send, syncers: 1") == 1);
+                CHECK(hook.details.count("/test/test/param") == 1);
+            }
+            THEN ("The trace should be available as Chrome trace event JSON") {
+                std::ostringstream trace;
+                writeChromeTrace(trace);
+                CHECK(trace.str().find("{\"traceEvents\":[") == 0);
+                CHECK(trace.str().find("\"name\":\"restore\"") != std::string::npos);
+                CHECK(trace.str().find("\"detail\":\"Domain/Conf\"") != std::string::npos);
+            }
+        }
+        WHEN ("The trace hook uses the tracing API") {
+            ReentrantTraceHook reentrantHook(*this);
+            setTraceHook(&reentrantHook);
+            REQUIRE_NOTHROW(start());
+
+            THEN ("It should not deadlock, its removal taking effect for the next step") {
+                CHECK(reentrantHook.calls == 1);
+                CHECK(reentrantHook.trace.find("{\"traceEvents\":[") == 0);
+                CHECK(hook.names.empty());
+            }
+        }
+        WHEN ("Tracing is disabled") {
+            setTracing(false);
+            setTraceHook(nullptr);
+            REQUIRE_NOTHROW(start());
+
+            THEN ("Nothing should have been traced") {
+                CHECK(hook.names.empty());
+                std::ostringstream trace;
+                writeChromeTrace(trace);
+                CHECK(trace.str().find("\"name\"") == std::string::npos);
+            }
+        }
+    }
+}
+} // namespace parameterFramework
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+
+#include <string>
+
+namespace parameterFramework
+{
+
+/** Parameter Framework holding a single boolean parameter, "/test/test/param",
+ * handled by the introspection subsystem.
+ *
+ * It is the only element of the "Domain" domain, whose single configuration, "Conf",
+ * is always applicable.
+ */
+struct BoolPF : public ParameterFramework
+{
+    /** @param[in] value the value of the parameter within "Conf" */
+    BoolPF(bool value = false) : ParameterFramework{createConfig(value)} {}
+
+    /** Set the boolean parameter value within the "Conf" configuration. */
+    void setParameterValue(bool value)
+    {
+        std::string valueStr = toString(value);
+        setConfigurationParameter("Domain", "Conf", "/test/test/param", valueStr);
+    }
+
+private:
+    static std::string toString(bool value) { return value ? "1" : "0"; }
+
+    static Config createConfig(bool value)
+    {
+        Config config;
+        config.instances = R"(<BooleanParameter Name="param" Mapping="Object"/>)";
+        config.plugins = {{"", {"introspection-subsystem"}}};
+        config.subsystemType = "INTROSPECTION";
+
+        config.domains = R"(<ConfigurableDomain Name="Domain">
+                                <Configurations>
+                                    <Configuration Name="Conf">
+                                        <CompoundRule Type="All"/>
+                                    </Configuration>
+                                </Configurations>
+
+                                <ConfigurableElements>
+                                    <ConfigurableElement Path="/test/test/param"/>
+                                </ConfigurableElements>
+
+                                <Settings>
+                                    <Configuration Name="Conf">
+                                        <ConfigurableElement Path="/test/test/param">
+                                            <BooleanParameter Name="param">)" +
+                         toString(value) + R"(</BooleanParameter>
+                                        </ConfigurableElement>
+                                    </Configuration>
+                                </Settings>
+                            </ConfigurableDomain>)";
+
+        return config;
+    }
+};
+
+} // namespace parameterFramework
@@ -76,6 +76,8 @@ public:
     /** Wrap EH::getAsDouble to throw an exception on failure. */
     void getAsDouble(double &value) const { mayFailCall(&EH::getAsDouble, value); }
 
+    void getAsBoolean(bool &value) const { mayFailCall(&EH::getAsBoolean, value); }
+
     void setAsInteger(uint32_t value) { mayFailCall(&EH::setAsInteger, value); }
     void getAsInteger(uint32_t &value) const { mayFailCall(&EH::getAsInteger, value); }
     void setAsIntegerArray(const std::vector<uint32_t> &value)
@@ -98,6 +100,42 @@ public:
         mayFailCall(&EH::getAsSignedIntegerArray, value);
     }
 
+    void setAsDoubleArray(const std::vector<double> &value)
+    {
+        mayFailCall(&EH::setAsDoubleArray, value);
+    }
+    void getAsDoubleArray(std::vector<double> &value) const
+    {
+        mayFailCall(&EH::getAsDoubleArray, value);
+    }
+
+    /** Wrap EH bulk buffer accessors to throw an exception on failure. @{ */
+    void setAsIntegerBuffer(const uint32_t *values, size_t length)
+    {
+        mayFailCall(&EH::setAsIntegerBuffer, values, length);
+    }
+    void getAsIntegerBuffer(uint32_t *values, size_t length) const
+    {
+        mayFailCall(&EH::getAsIntegerBuffer, values, length);
+    }
+    void setAsSignedIntegerBuffer(const int32_t *values, size_t length)
+    {
+        mayFailCall(&EH::setAsSignedIntegerBuffer, values, length);
+    }
+    void getAsSignedIntegerBuffer(int32_t *values, size_t length) const
+    {
+        mayFailCall(&EH::getAsSignedIntegerBuffer, values, length);
+    }
+    void setAsDoubleBuffer(const double *values, size_t length)
+    {
+        mayFailCall(&EH::setAsDoubleBuffer, values, length);
+    }
+    void getAsDoubleBuffer(double *values, size_t length) const
+    {
+        mayFailCall(&EH::getAsDoubleBuffer, values, length);
+    }
+    /** @} */
+
     std::string getStructureAsXML() const { return mayFailGet(&EH::getStructureAsXML); }
 
     std::string getAsXML() const { return mayFailGet(&EH::getAsXML); }
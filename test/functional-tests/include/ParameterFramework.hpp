@@ -75,6 +75,8 @@ public:
      * can not fail (no failure to throw).
      * @{ */
     using PF::applyConfigurations;
+    using PF::createSelectionCriterionType;
+    using PF::createSelectionCriterion;
     using PF::getFailureOnMissingSubsystem;
     using PF::getFailureOnFailedSettingsLoad;
     using PF::getForceNoRemoteInterface;
@@ -87,6 +89,16 @@ public:
     using PF::isTuningModeOn;
     using PF::isAutoSyncOn;
     using PF::setLogger;
+    using PF::setLogLevel;
+    using PF::getAsynchronousLogging;
+    using PF::getDroppedLogCount;
+    using PF::getTracing;
+    using PF::setTraceHook;
+    using PF::writeChromeTrace;
+    using PF::writeMetrics;
+    using PF::resetMetrics;
+    using PF::writeStartupProfile;
+    using PF::getLogLevel;
     using PF::createCommandHandler;
     /** @} */
 
@@ -102,6 +114,15 @@ public:
         mayFailCall(&PPF::setFailureOnFailedSettingsLoad, fail);
     }
 
+    /** Wrap PF::setAsynchronousLogging to throw an exception on failure. */
+    void setAsynchronousLogging(bool asynchronous, size_t capacity = PPF::defaultLogBufferCapacity)
+    {
+        mayFailCall(&PPF::setAsynchronousLogging, asynchronous, capacity);
+    }
+
+    /** Wrap PF::setTracing to throw an exception on failure. */
+    void setTracing(bool enable) { mayFailCall(&PPF::setTracing, enable); }
+
     /** Wrap PF::setFailureOnMissingSubsystem to throw an exception on failure. */
     void setFailureOnMissingSubsystem(bool fail)
     {
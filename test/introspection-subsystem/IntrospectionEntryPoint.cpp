@@ -40,5 +40,15 @@ bool getParameterValue()
 {
     return SubsystemObject::getSingletonInstanceValue();
 }
+
+std::vector<Sync> getSyncs()
+{
+    return SubsystemObject::getSyncs();
+}
+
+void resetSyncs()
+{
+    SubsystemObject::resetSyncs();
+}
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
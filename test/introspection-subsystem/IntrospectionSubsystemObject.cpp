@@ -37,7 +37,10 @@ namespace parameterFramework
 namespace introspectionSubsystem
 {
 
-const SubsystemObject *SubsystemObject::mSingletonInstance = nullptr;
+std::set<const SubsystemObject *> SubsystemObject::mInstances;
+
+std::mutex SubsystemObject::mSyncsMutex;
+std::vector<Sync> SubsystemObject::mSyncs;
 
 /* Helper function */
 const CParameterType *geParameterType(CInstanceConfigurableElement *element)
@@ -48,7 +51,8 @@ const CParameterType *geParameterType(CInstanceConfigurableElement *element)
 SubsystemObject::SubsystemObject(const std::string & /*mappingValue*/,
                                  CInstanceConfigurableElement *instanceConfigurableElement,
                                  const CMappingContext & /*context*/, core::log::Logger &logger)
-    : base(instanceConfigurableElement, logger), mParameter(false)
+    : base(instanceConfigurableElement, logger), mPath(instanceConfigurableElement->getPath()),
+      mParameter(false)
 {
     /* Checking that structure matches the internal parameter */
     ALWAYS_ASSERT(geParameterType(instanceConfigurableElement)->getSize() == parameterSize,
@@ -58,24 +62,26 @@ SubsystemObject::SubsystemObject(const std::string & /*mappingValue*/,
     ALWAYS_ASSERT(geParameterType(instanceConfigurableElement)->isScalar(),
                   "Parameter shall be scalar");
 
-    /* Registering the instance into a singleton */
+    /* Registering the instance */
     registerInstance(*this);
 }
 
 SubsystemObject::~SubsystemObject()
 {
-    /* Unregistering the instance from the singleton */
+    /* Unregistering the instance */
     unregisterInstance(*this);
 }
 
 bool SubsystemObject::sendToHW(std::string & /*error*/)
 {
+    recordSync(false);
     blackboardRead(&mParameter, parameterSize);
     return true;
 }
 
 bool SubsystemObject::receiveFromHW(std::string & /*error*/)
 {
+    recordSync(true);
     blackboardRead(&mParameter, parameterSize);
     return true;
 }
@@ -29,9 +29,13 @@
  */
 #pragma once
 
+#include "IntrospectionEntryPoint.h"
 #include <SubsystemObject.h>
 #include <AlwaysAssert.hpp>
+#include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 
 class CMappingContext;
 
@@ -42,7 +46,9 @@ namespace introspectionSubsystem
 
 /** This subsystem object exposes a boolean parameter. The value of this parameter
  * can be retrieved by an external code that calls the getSingletonInstanceValue()
- * static method.
+ * static method, provided that there is a single instance.
+ *
+ * The synchronizations of all the instances are recorded, see getSyncs().
  */
 class SubsystemObject final : public CSubsystemObject
 {
@@ -54,8 +60,20 @@ public:
 
     static bool getSingletonInstanceValue()
     {
-        ALWAYS_ASSERT(mSingletonInstance != nullptr, "Singleton value has not been registered");
-        return mSingletonInstance->mParameter;
+        ALWAYS_ASSERT(mInstances.size() == 1, "There is not a single instance registered");
+        return (*mInstances.begin())->mParameter;
+    }
+
+    static std::vector<Sync> getSyncs()
+    {
+        std::lock_guard<std::mutex> lock(mSyncsMutex);
+        return mSyncs;
+    }
+
+    static void resetSyncs()
+    {
+        std::lock_guard<std::mutex> lock(mSyncsMutex);
+        mSyncs.clear();
     }
 
 private:
@@ -66,23 +84,30 @@ private:
 
     static void registerInstance(const SubsystemObject &instance)
     {
-        ALWAYS_ASSERT(mSingletonInstance == nullptr, "An instance is already registered");
-        mSingletonInstance = &instance;
+        bool inserted = mInstances.insert(&instance).second;
+        ALWAYS_ASSERT(inserted, "This instance is already registered");
     }
 
     static void unregisterInstance(const SubsystemObject &instance)
     {
-        // instance parameter is only used by assertion, so unused in release mode
-        (void)instance;
+        bool erased = mInstances.erase(&instance) == 1;
+        ALWAYS_ASSERT(erased, "This instance was not registered.");
+    }
 
-        ALWAYS_ASSERT(mSingletonInstance == &instance, "This instance was not registered.");
-        mSingletonInstance = nullptr;
+    void recordSync(bool bReceive)
+    {
+        std::lock_guard<std::mutex> lock(mSyncsMutex);
+        mSyncs.push_back({mPath, bReceive});
     }
 
     static const std::size_t parameterSize = sizeof(bool);
 
-    static const SubsystemObject *mSingletonInstance;
+    static std::set<const SubsystemObject *> mInstances;
+
+    static std::mutex mSyncsMutex;
+    static std::vector<Sync> mSyncs;
 
+    const std::string mPath;
     bool mParameter;
 };
 } // namespace introspectionSubsystem
@@ -31,11 +31,29 @@
 
 #include "introspection_subsystem_export.h"
 
+#include <string>
+#include <vector>
+
 namespace parameterFramework
 {
 namespace introspectionSubsystem
 {
 
+/** @return the value of the boolean parameter, the subsystem must have a single object */
 INTROSPECTION_SUBSYSTEM_EXPORT bool getParameterValue();
+
+/** Synchronization of a subsystem object */
+struct Sync
+{
+    /** Path of the subsystem object element */
+    std::string path;
+    /** true if read from the subsystem, false if written to it */
+    bool bReceive;
+};
+
+/** @return the synchronizations of all the subsystem objects since the last reset, in order */
+INTROSPECTION_SUBSYSTEM_EXPORT std::vector<Sync> getSyncs();
+
+INTROSPECTION_SUBSYSTEM_EXPORT void resetSyncs();
 } // namespace introspectionSubsystem
 } // namespace parameterFramework
@@ -176,9 +176,12 @@ CTestPlatform::CommandReturn CTestPlatform::createInclusiveSelectionCriterion(
 CTestPlatform::CommandReturn CTestPlatform::startParameterMgr(
     const IRemoteCommand & /*remoteCommand*/, string &strResult)
 {
-    return mParameterMgrPlatformConnector.start(strResult)
-               ? CTestPlatform::CCommandHandler::EDone
-               : CTestPlatform::CCommandHandler::EFailed;
+    if (!mParameterMgrPlatformConnector.start(strResult)) {
+        return CTestPlatform::CCommandHandler::EFailed;
+    }
+    mParameterMgrPlatformConnector.writeStartupProfile(std::cout);
+    std::cout.flush();
+    return CTestPlatform::CCommandHandler::EDone;
 }
 
 template <CTestPlatform::setter_t setFunction>
@@ -111,4 +111,39 @@ SCENARIO("Tokenizer tests")
             }
         }
     }
+
+    GIVEN ("A tokenizer read token by token") {
+        const string input = ",a,,bc, ";
+        Tokenizer merging(input, ", ");
+        Tokenizer notMerging(input, ",", false);
+
+        THEN ("Tokens should be the same as split() ones") {
+            CHECK(merging.remaining() == 2);
+            CHECK(notMerging.remaining() == 5);
+
+            for (auto &test : {std::make_pair(&merging, Expected{"a", "bc"}),
+                               std::make_pair(&notMerging, Expected{"", "a", "", "bc", " "})}) {
+                Tokenizer &tokenizer = *test.first;
+                Expected tokens;
+                string token;
+                while (tokenizer.next(token)) {
+                    tokens.push_back(token);
+                    CHECK(tokenizer.remaining() == test.second.size() - tokens.size());
+                }
+                CHECK(tokens == test.second);
+                CHECK_FALSE(tokenizer.next(token));
+            }
+        }
+
+        THEN ("Token positions should refer to the input string") {
+            size_t first;
+            size_t length;
+            REQUIRE(merging.next(first, length));
+            CHECK(first == 1);
+            CHECK(length == 1);
+            REQUIRE(merging.next(first, length));
+            CHECK(input.substr(first, length) == "bc");
+            CHECK_FALSE(merging.next(first, length));
+        }
+    }
 }
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "ParameterMgrPlatformConnector.h"
+#include "SelectionCriterionInterface.h"
+#include "SelectionCriterionTypeInterface.h"
+#include "CriterionTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace criterionReplay
+{
+
+/** A replayed configuration application */
+struct Application
+{
+    /** Recorded time in microseconds */
+    uint64_t time;
+    /** Duration of the application in microseconds */
+    double latency;
+    /** Configurations applied, as "<domain>/<configuration>" */
+    std::vector<std::string> changes;
+};
+
+/** Forward the warnings of the replayed parameter framework to the error output */
+class WarningLogger : public CParameterMgrPlatformConnector::ILogger
+{
+public:
+    void info(const std::string &) override {}
+    void warning(const std::string &log) override { std::cerr << log << std::endl; }
+};
+
+/** Replay a criterion trace on the given configuration files
+ *
+ * The parameter framework is started with the recorded criteria in their recorded states,
+ * falling back on virtual subsystems for the missing plugins. Information logs are disabled
+ * so that their formatting is not timed with the applications. The configurations applied
+ * are queried after each application, out of the timed section.
+ *
+ * @param[in] configurationPath the top level configuration file
+ * @param[in] trace the criterion trace to replay
+ * @param[in] bRealTime true to respect the recorded timing, false to replay as fast as possible
+ * @param[out] applications the replayed applications, in order
+ * @param[out] strError the error if the parameter framework can not be started
+ * @return true on success, false otherwise
+ */
+inline bool replay(const std::string &configurationPath,
+                   const utility::criterionTrace::Reader &trace, bool bRealTime,
+                   std::vector<Application> &applications, std::string &strError)
+{
+    using Clock = std::chrono::steady_clock;
+
+    WarningLogger logger;
+    CParameterMgrPlatformConnector pfw(configurationPath);
+    pfw.setLogger(&logger);
+    pfw.setLogLevel(CParameterMgrPlatformConnector::LogLevel::warning);
+    pfw.setForceNoRemoteInterface(true);
+    // Plugins of the recording device are usually not available offline
+    if (!pfw.setFailureOnMissingSubsystem(false, strError)) {
+        return false;
+    }
+
+    std::vector<ISelectionCriterionInterface *> criteria;
+    for (auto &definition : trace.getDefinitions()) {
+
+        ISelectionCriterionTypeInterface *type =
+            pfw.createSelectionCriterionType(definition.bInclusive);
+        for (auto &valuePair : definition.valuePairs) {
+            if (!type->addValuePair(valuePair.first, valuePair.second, strError)) {
+                return false;
+            }
+        }
+        criteria.push_back(pfw.createSelectionCriterion(definition.name, type));
+        criteria.back()->setCriterionState(definition.state);
+    }
+
+    if (!pfw.start(strError)) {
+        return false;
+    }
+    std::vector<std::string> applied = pfw.getAppliedConfigurations();
+
+    auto start = Clock::now();
+    for (auto &event : trace.getEvents()) {
+
+        if (bRealTime) {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(event.time));
+        }
+        if (!event.bApply) {
+            criteria[event.criterion]->setCriterionState(event.state);
+            continue;
+        }
+        auto applyStart = Clock::now();
+        pfw.applyConfigurations();
+        std::chrono::duration<double, std::micro> latency = Clock::now() - applyStart;
+
+        Application application{event.time, latency.count(), {}};
+        std::vector<std::string> previous;
+        previous.swap(applied);
+        applied = pfw.getAppliedConfigurations();
+        for (auto &configuration : applied) {
+            if (std::find(previous.begin(), previous.end(), configuration) == previous.end()) {
+                application.changes.push_back(configuration);
+            }
+        }
+        applications.push_back(application);
+    }
+    return true;
+}
+
+} // namespace criterionReplay
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Replay a criterion trace recorded by CParameterMgrPlatformConnector::startCriterionRecording
+ *
+ * The parameter framework is started on the given configuration files, falling back on
+ * virtual subsystems for the missing plugins, with the recorded criteria in their recorded
+ * states. The criterion changes and the configuration applications are then replayed, as
+ * fast as possible or in real time, and the latency and the configurations changed by each
+ * application are printed as JSON.
+ */
+
+#include "CriterionReplay.hpp"
+#include "CriterionTrace.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace criterionReplay;
+
+static void showUsage()
+{
+    cerr << "criterionReplay [--real-time] <top level configuration file> <criterion trace>\n"
+            "Replay the criterion changes and configuration applications of the trace as fast "
+            "as possible, or respecting the recorded timing with --real-time, and print the "
+            "latency and the changed configurations of each application as JSON."
+         << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    vector<string> arguments(argv + 1, argv + argc);
+
+    bool bRealTime = !arguments.empty() && arguments.front() == "--real-time";
+    if (bRealTime) {
+        arguments.erase(arguments.begin());
+    }
+    if (arguments.size() != 2) {
+        showUsage();
+        return 1;
+    }
+
+    string strError;
+    utility::criterionTrace::Reader trace;
+    vector<Application> applications;
+
+    if (!trace.read(arguments[1], strError) ||
+        !replay(arguments[0], trace, bRealTime, applications, strError)) {
+
+        cerr << "criterionReplay error: " << strError << endl;
+        return 1;
+    }
+
+    cout << "{\"applications\":[";
+    for (size_t index = 0; index < applications.size(); index++) {
+
+        const Application &application = applications[index];
+        cout << (index == 0 ? "" : ",") << "\n{\"time_us\":" << application.time
+             << ",\"latency_us\":" << application.latency << ",\"changes\":[";
+        for (size_t change = 0; change < application.changes.size(); change++) {
+            cout << (change == 0 ? "" : ",") << utility::asJsonString(application.changes[change]);
+        }
+        cout << "]}";
+    }
+
+    vector<double> latencies;
+    for (auto &application : applications) {
+        latencies.push_back(application.latency);
+    }
+    sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double ratio) {
+        return latencies.empty() ? 0 : latencies[static_cast<size_t>(
+                                           ratio * static_cast<double>(latencies.size() - 1))];
+    };
+    double sum = 0;
+    for (auto latency : latencies) {
+        sum += latency;
+    }
+
+    cout << "],\n\"summary\":{\"count\":" << latencies.size() << ",\"mean_us\":"
+         << (latencies.empty() ? 0 : sum / static_cast<double>(latencies.size()))
+         << ",\"p50_us\":" << percentile(0.5) << ",\"p99_us\":" << percentile(0.99)
+         << ",\"max_us\":" << (latencies.empty() ? 0 : latencies.back()) << "}}" << endl;
+    return 0;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace scaleGenerator
+{
+
+/** Counts of the generated configuration */
+struct Sizes
+{
+    size_t subsystems = 4;
+    size_t componentsPerSubsystem = 16;
+    size_t parametersPerComponent = 8;
+    /** Length of the array parameter of each component, 0 for no array parameter */
+    size_t arrayLength = 0;
+    size_t criteria = 8;
+    /** Number of states of each criterion */
+    size_t criterionStates = 4;
+    size_t domains = 32;
+    size_t configurationsPerDomain = 8;
+    /** Number of nested compound rules of each configuration */
+    size_t ruleDepth = 2;
+    /** Number of criteria referenced by the rules of each domain
+     *
+     * Domain d references criteria d to d + overlap - 1 (modulo the criterion count),
+     * hence each criterion is shared by about domains * overlap / criteria domains.
+     */
+    size_t overlap = 2;
+};
+
+/** An exclusive criterion, its states having the values 0 to states.size() - 1 */
+struct Criterion
+{
+    std::string name;
+    std::vector<std::string> states;
+};
+
+/** Generate a consistent top level configuration, structure and settings of any size
+ *
+ * All subsystems are virtual so that the configuration can be loaded on any machine.
+ * Each subsystem holds instances of one component type holding integer parameters.
+ * Components are dispatched in turn to the domains. The last configuration of each
+ * domain is a default one, always applicable.
+ */
+class ScaleGenerator
+{
+public:
+    static const char *systemClassName() { return "Scale"; }
+
+    explicit ScaleGenerator(const Sizes &sizes) : mSizes(sizes) {}
+
+    /** @return false, filling error, if the sizes can not produce a valid configuration */
+    bool validate(std::string &error) const
+    {
+        const Sizes &s = mSizes;
+
+        if (s.subsystems == 0 || s.componentsPerSubsystem == 0 || s.parametersPerComponent == 0) {
+            error = "At least one subsystem, component and parameter are needed";
+        } else if (s.domains > s.subsystems * s.componentsPerSubsystem) {
+            error = "Each domain needs at least one component, there are not enough of them";
+        } else if (s.configurationsPerDomain == 0 || s.ruleDepth == 0) {
+            error = "At least one configuration per domain and one rule level are needed";
+        } else if (s.criteria == 0 || s.criterionStates == 0) {
+            error = "At least one criterion with one state is needed";
+        } else if (s.overlap == 0 || s.overlap > s.criteria) {
+            error = "The overlap must be between 1 and the number of criteria";
+        } else {
+            return true;
+        }
+        return false;
+    }
+
+    std::vector<Criterion> getCriteria() const
+    {
+        std::vector<Criterion> criteria(mSizes.criteria);
+
+        for (size_t criterion = 0; criterion < mSizes.criteria; criterion++) {
+
+            criteria[criterion].name = criterionName(criterion);
+            for (size_t state = 0; state < mSizes.criterionStates; state++) {
+                criteria[criterion].states.push_back("state" + std::to_string(state));
+            }
+        }
+        return criteria;
+    }
+
+    /** @param[in] structurePath path of the structure, relative to the top level file
+     * @param[in] domainsPath path of the settings, relative to the top level file
+     * @param[in] serverPort port of the remote interface, none if empty
+     */
+    std::string getTopLevel(const std::string &structurePath, const std::string &domainsPath,
+                            const std::string &serverPort = "") const
+    {
+        std::ostringstream xml;
+
+        xml << "<?xml version='1.0' encoding='UTF-8'?>\n"
+            << "<ParameterFrameworkConfiguration SystemClassName='" << systemClassName() << "'"
+            << (serverPort.empty() ? "" : " ServerPort='" + serverPort + "'")
+            << " TuningAllowed='true'>\n"
+            << "    <SubsystemPlugins/>\n"
+            << "    <StructureDescriptionFileLocation Path='" << structurePath << "'/>\n"
+            << "    <SettingsConfiguration>\n"
+            << "        <ConfigurableDomainsFileLocation Path='" << domainsPath << "'/>\n"
+            << "    </SettingsConfiguration>\n"
+            << "</ParameterFrameworkConfiguration>\n";
+        return xml.str();
+    }
+
+    std::string getStructure() const
+    {
+        std::ostringstream xml;
+
+        xml << "<?xml version='1.0' encoding='UTF-8'?>\n"
+            << "<SystemClass Name='" << systemClassName() << "'>\n";
+
+        for (size_t subsystem = 0; subsystem < mSizes.subsystems; subsystem++) {
+
+            xml << "  <Subsystem Name='" << subsystemName(subsystem) << "' Type='Virtual'>\n"
+                << "    <ComponentLibrary>\n"
+                << "      <ComponentType Name='Component'>\n";
+            for (size_t parameter = 0; parameter < mSizes.parametersPerComponent; parameter++) {
+                xml << "        <IntegerParameter Name='" << parameterName(parameter)
+                    << "' Size='32'/>\n";
+            }
+            if (mSizes.arrayLength != 0) {
+                xml << "        <IntegerParameter Name='array' Size='32' ArrayLength='"
+                    << mSizes.arrayLength << "'/>\n";
+            }
+            xml << "      </ComponentType>\n"
+                << "    </ComponentLibrary>\n"
+                << "    <InstanceDefinition>\n";
+            for (size_t component = 0; component < mSizes.componentsPerSubsystem; component++) {
+                xml << "      <Component Name='" << componentName(component)
+                    << "' Type='Component'/>\n";
+            }
+            xml << "    </InstanceDefinition>\n"
+                << "  </Subsystem>\n";
+        }
+        xml << "</SystemClass>\n";
+        return xml.str();
+    }
+
+    std::string getDomains() const
+    {
+        std::ostringstream xml;
+
+        xml << "<?xml version='1.0' encoding='UTF-8'?>\n"
+            << "<ConfigurableDomains SystemClassName='" << systemClassName() << "'>\n";
+
+        for (size_t domain = 0; domain < mSizes.domains; domain++) {
+            writeDomain(xml, domain);
+        }
+        xml << "</ConfigurableDomains>\n";
+        return xml.str();
+    }
+
+private:
+    static std::string criterionName(size_t criterion)
+    {
+        return "criterion" + std::to_string(criterion);
+    }
+    static std::string subsystemName(size_t subsystem)
+    {
+        return "subsystem" + std::to_string(subsystem);
+    }
+    static std::string componentName(size_t component)
+    {
+        return "component" + std::to_string(component);
+    }
+    static std::string parameterName(size_t parameter)
+    {
+        return "param" + std::to_string(parameter);
+    }
+
+    /** @return the paths of the components of a domain, dispatched in turn to the domains */
+    std::vector<std::string> getDomainElements(size_t domain) const
+    {
+        std::vector<std::string> paths;
+        size_t components = mSizes.subsystems * mSizes.componentsPerSubsystem;
+
+        for (size_t component = domain; component < components; component += mSizes.domains) {
+            paths.push_back(std::string("/") + systemClassName() + "/" +
+                            subsystemName(component / mSizes.componentsPerSubsystem) + "/" +
+                            componentName(component % mSizes.componentsPerSubsystem));
+        }
+        return paths;
+    }
+
+    /** Write a compound rule and its nested rules, down to the rule depth
+     *
+     * Each level tests each criterion of the domain and alternates between "All" of "Is"
+     * rules and "Any" of "IsNot" rules, so that a configuration is applicable whenever the
+     * criteria match the states of its top level.
+     */
+    void writeRule(std::ostream &xml, size_t domain, size_t configuration, size_t level) const
+    {
+        xml << "<CompoundRule Type='" << (level % 2 == 0 ? "All" : "Any") << "'>";
+        for (size_t index = 0; index < mSizes.overlap; index++) {
+
+            size_t criterion = (domain + index) % mSizes.criteria;
+            size_t state = (configuration + level + index) % mSizes.criterionStates;
+            xml << "<SelectionCriterionRule SelectionCriterion='" << criterionName(criterion)
+                << "' MatchesWhen='" << (level % 2 == 0 ? "Is" : "IsNot") << "' Value='state"
+                << state << "'/>";
+        }
+        if (level + 1 < mSizes.ruleDepth) {
+            writeRule(xml, domain, configuration, level + 1);
+        }
+        xml << "</CompoundRule>";
+    }
+
+    void writeDomain(std::ostream &xml, size_t domain) const
+    {
+        std::vector<std::string> elements = getDomainElements(domain);
+        size_t configurations = mSizes.configurationsPerDomain;
+
+        xml << "  <ConfigurableDomain Name='domain" << domain << "'>\n"
+            << "    <Configurations>\n";
+        for (size_t configuration = 0; configuration < configurations; configuration++) {
+
+            xml << "      <Configuration Name='conf" << configuration << "'>";
+            if (configuration + 1 == configurations) {
+                // Default configuration
+                xml << "<CompoundRule Type='All'/>";
+            } else {
+                writeRule(xml, domain, configuration, 0);
+            }
+            xml << "</Configuration>\n";
+        }
+        xml << "    </Configurations>\n"
+            << "    <ConfigurableElements>\n";
+        for (auto &path : elements) {
+            xml << "      <ConfigurableElement Path='" << path << "'/>\n";
+        }
+        xml << "    </ConfigurableElements>\n"
+            << "    <Settings>\n";
+        for (size_t configuration = 0; configuration < configurations; configuration++) {
+
+            xml << "      <Configuration Name='conf" << configuration << "'>\n";
+            for (auto &path : elements) {
+                xml << "        <ConfigurableElement Path='" << path << "'><ParameterBlock Name='"
+                    << path.substr(path.rfind('/') + 1) << "'>";
+                writeComponentSettings(xml, configuration);
+                xml << "</ParameterBlock></ConfigurableElement>\n";
+            }
+            xml << "      </Configuration>\n";
+        }
+        xml << "    </Settings>\n"
+            << "  </ConfigurableDomain>\n";
+    }
+
+    void writeComponentSettings(std::ostream &xml, size_t configuration) const
+    {
+        for (size_t parameter = 0; parameter < mSizes.parametersPerComponent; parameter++) {
+            xml << "<IntegerParameter Name='" << parameterName(parameter) << "'>"
+                << configuration + parameter << "</IntegerParameter>";
+        }
+        if (mSizes.arrayLength != 0) {
+            xml << "<IntegerParameter Name='array'>";
+            for (size_t index = 0; index < mSizes.arrayLength; index++) {
+                xml << (index == 0 ? "" : " ") << configuration + index;
+            }
+            xml << "</IntegerParameter>";
+        }
+    }
+
+    Sizes mSizes;
+};
+
+} // namespace scaleGenerator
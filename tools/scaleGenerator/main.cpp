@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ScaleGenerator.hpp"
+#include "convert.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+using std::cerr;
+using std::endl;
+using std::string;
+
+static void showUsage()
+{
+    cerr << "scaleGenerator [--output <directory, default .>] [--server-port <port>]\n"
+            "               [--subsystems <count>] [--components <count per subsystem>]\n"
+            "               [--parameters <count per component>] [--array-length <length>]\n"
+            "               [--criteria <count>] [--states <count per criterion>]\n"
+            "               [--domains <count>] [--configurations <count per domain>]\n"
+            "               [--rule-depth <depth>] [--overlap <criteria per domain>]\n"
+            "Write ParameterFrameworkConfiguration.xml, Structure.xml, Domains.xml and\n"
+            "criteria.txt (one exclusive criterion per line: name then states) in the output\n"
+            "directory."
+         << endl;
+}
+
+static bool writeFile(const string &path, const string &content)
+{
+    std::ofstream file(path);
+    file << content;
+    file.close();
+
+    if (!file) {
+        cerr << "Could not write " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    scaleGenerator::Sizes sizes;
+    string output = ".";
+    string serverPort;
+
+    std::map<string, size_t *> counts = {{"--subsystems", &sizes.subsystems},
+                                         {"--components", &sizes.componentsPerSubsystem},
+                                         {"--parameters", &sizes.parametersPerComponent},
+                                         {"--array-length", &sizes.arrayLength},
+                                         {"--criteria", &sizes.criteria},
+                                         {"--states", &sizes.criterionStates},
+                                         {"--domains", &sizes.domains},
+                                         {"--configurations", &sizes.configurationsPerDomain},
+                                         {"--rule-depth", &sizes.ruleDepth},
+                                         {"--overlap", &sizes.overlap}};
+
+    for (int index = 1; index < argc; index++) {
+
+        string option = argv[index];
+        if (option == "-h" || option == "--help") {
+            showUsage();
+            return 0;
+        }
+        if (index + 1 == argc) {
+            showUsage();
+            return 1;
+        }
+        string argument = argv[++index];
+        uint16_t port;
+
+        auto count = counts.find(option);
+        if (count != counts.end()) {
+            if (!convertTo(argument, *count->second)) {
+                cerr << "Invalid count for " << option << ": " << argument << endl;
+                return 1;
+            }
+        } else if (option == "--output") {
+            output = argument;
+        } else if (option == "--server-port" && convertTo(argument, port)) {
+            serverPort = argument;
+        } else {
+            cerr << "Invalid option or argument: " << option << " " << argument << endl;
+            showUsage();
+            return 1;
+        }
+    }
+
+    scaleGenerator::ScaleGenerator generator(sizes);
+    string error;
+    if (!generator.validate(error)) {
+        cerr << "Invalid sizes: " << error << endl;
+        return 1;
+    }
+
+    string criteria;
+    for (auto &criterion : generator.getCriteria()) {
+        criteria += criterion.name;
+        for (auto &state : criterion.states) {
+            criteria += " " + state;
+        }
+        criteria += "\n";
+    }
+
+    bool success =
+        writeFile(output + "/ParameterFrameworkConfiguration.xml",
+                  generator.getTopLevel("Structure.xml", "Domains.xml", serverPort)) &&
+        writeFile(output + "/Structure.xml", generator.getStructure()) &&
+        writeFile(output + "/Domains.xml", generator.getDomains()) &&
+        writeFile(output + "/criteria.txt", criteria);
+
+    return success ? 0 : 1;
+}
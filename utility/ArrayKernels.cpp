@@ -0,0 +1,681 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ArrayKernels.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PFW_KERNELS_AVX2
+#include <immintrin.h>
+#endif
+
+namespace utility
+{
+namespace kernels
+{
+
+namespace
+{
+
+double qnmScale(const QnmFormat &format)
+{
+    return std::ldexp(1.0, static_cast<int>(format.fractional));
+}
+
+namespace scalar
+{
+
+template <class T>
+bool inRange(const T *values, size_t count, T min, T max)
+{
+    for (size_t index = 0; index < count; ++index) {
+
+        // Written so that NaN is out of range
+        if (!(values[index] >= min && values[index] <= max)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool inRangeSigned(const int32_t *values, size_t count, int32_t min, int32_t max)
+{
+    return inRange(values, count, min, max);
+}
+
+bool inRangeUnsigned(const uint32_t *values, size_t count, uint32_t min, uint32_t max)
+{
+    return inRange(values, count, min, max);
+}
+
+bool inRangeDouble(const double *values, size_t count, double min, double max)
+{
+    return inRange(values, count, min, max);
+}
+
+bool inRangeFloat(const double *values, size_t count, float min, float max)
+{
+    for (size_t index = 0; index < count; ++index) {
+
+        double value = values[index];
+        if (!(value >= -FLT_MAX && value <= FLT_MAX)) {
+            return false;
+        }
+        float converted = static_cast<float>(value);
+        if (!(converted >= min && converted <= max)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Storage, class Value>
+void packAs(const Value *values, size_t count, uint8_t *dest)
+{
+    for (size_t index = 0; index < count; ++index) {
+
+        Storage stored = static_cast<Storage>(values[index]);
+        memcpy(dest + index * sizeof(stored), &stored, sizeof(stored));
+    }
+}
+
+void pack(const uint32_t *values, size_t count, size_t size, uint8_t *dest)
+{
+    switch (size) {
+    case 1:
+        packAs<uint8_t>(values, count, dest);
+        break;
+    case 2:
+        packAs<uint16_t>(values, count, dest);
+        break;
+    default:
+        memcpy(dest, values, count * sizeof(*values));
+        break;
+    }
+}
+
+template <class Storage, class Value>
+void unpackAs(const uint8_t *src, size_t count, Value *values)
+{
+    for (size_t index = 0; index < count; ++index) {
+
+        Storage stored;
+        memcpy(&stored, src + index * sizeof(stored), sizeof(stored));
+        values[index] = stored;
+    }
+}
+
+void unpackSigned(const uint8_t *src, size_t count, size_t size, int32_t *values)
+{
+    switch (size) {
+    case 1:
+        unpackAs<int8_t>(src, count, values);
+        break;
+    case 2:
+        unpackAs<int16_t>(src, count, values);
+        break;
+    default:
+        memcpy(values, src, count * sizeof(*values));
+        break;
+    }
+}
+
+void unpackUnsigned(const uint8_t *src, size_t count, size_t size, uint32_t *values)
+{
+    switch (size) {
+    case 1:
+        unpackAs<uint8_t>(src, count, values);
+        break;
+    case 2:
+        unpackAs<uint16_t>(src, count, values);
+        break;
+    default:
+        memcpy(values, src, count * sizeof(*values));
+        break;
+    }
+}
+
+uint32_t toQnm(double value, double scale, uint32_t shift)
+{
+    int32_t iValue = static_cast<int32_t>(std::round(value * scale));
+    return static_cast<uint32_t>(iValue) << shift;
+}
+
+void doubleToQnm(const double *values, size_t count, const QnmFormat &format, uint8_t *dest)
+{
+    double scale = qnmScale(format);
+    uint32_t chunk[chunkSize];
+
+    for (size_t first = 0; first < count; first += chunkSize) {
+
+        size_t length = std::min(chunkSize, count - first);
+        for (size_t index = 0; index < length; ++index) {
+            chunk[index] = toQnm(values[first + index], scale, format.shift);
+        }
+        pack(chunk, length, format.size, dest + first * format.size);
+    }
+}
+
+void qnmToDouble(const uint8_t *src, size_t count, const QnmFormat &format, double *values)
+{
+    double scale = qnmScale(format);
+    int32_t chunk[chunkSize];
+
+    for (size_t first = 0; first < count; first += chunkSize) {
+
+        size_t length = std::min(chunkSize, count - first);
+        unpackSigned(src + first * format.size, length, format.size, chunk);
+        for (size_t index = 0; index < length; ++index) {
+            values[first + index] = (chunk[index] >> format.shift) / scale;
+        }
+    }
+}
+
+void doubleToFloat(const double *values, size_t count, uint8_t *dest)
+{
+    packAs<float>(values, count, dest);
+}
+
+void floatToDouble(const uint8_t *src, size_t count, double *values)
+{
+    unpackAs<float>(src, count, values);
+}
+
+template <class From, class To>
+void convert(const From *values, size_t count, To *results)
+{
+    for (size_t index = 0; index < count; ++index) {
+        results[index] = static_cast<To>(values[index]);
+    }
+}
+
+void signedToDouble(const int32_t *values, size_t count, double *results)
+{
+    convert(values, count, results);
+}
+
+void unsignedToDouble(const uint32_t *values, size_t count, double *results)
+{
+    convert(values, count, results);
+}
+
+void doubleToSigned(const double *values, size_t count, int32_t *results)
+{
+    convert(values, count, results);
+}
+
+void doubleToUnsigned(const double *values, size_t count, uint32_t *results)
+{
+    convert(values, count, results);
+}
+
+void linearToInteger(const double *values, size_t count, double numerator, double denominator,
+                     double offset, double *results)
+{
+    for (size_t index = 0; index < count; ++index) {
+        results[index] = std::trunc(values[index] * numerator / denominator) + offset;
+    }
+}
+
+void linearFromInteger(const double *values, size_t count, double offset, double numerator,
+                       double denominator, double *results)
+{
+    for (size_t index = 0; index < count; ++index) {
+        results[index] = (values[index] - offset) * numerator / denominator;
+    }
+}
+
+const Implementation implementation = {
+    "scalar",
+    inRangeSigned,
+    inRangeUnsigned,
+    inRangeDouble,
+    inRangeFloat,
+    pack,
+    unpackSigned,
+    unpackUnsigned,
+    doubleToQnm,
+    qnmToDouble,
+    doubleToFloat,
+    floatToDouble,
+    signedToDouble,
+    unsignedToDouble,
+    doubleToSigned,
+    doubleToUnsigned,
+    linearToInteger,
+    linearFromInteger,
+};
+
+} // namespace scalar
+
+#ifdef PFW_KERNELS_AVX2
+namespace avx2
+{
+
+#define PFW_AVX2 __attribute__((target("avx2")))
+
+PFW_AVX2 bool inRangeSigned(const int32_t *values, size_t count, int32_t min, int32_t max)
+{
+    const __m256i vMin = _mm256_set1_epi32(min);
+    const __m256i vMax = _mm256_set1_epi32(max);
+    __m256i outOfRange = _mm256_setzero_si256();
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8) {
+
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + index));
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi32(vMin, v));
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi32(v, vMax));
+    }
+    return _mm256_testz_si256(outOfRange, outOfRange) &&
+           scalar::inRange(values + index, count - index, min, max);
+}
+
+PFW_AVX2 bool inRangeUnsigned(const uint32_t *values, size_t count, uint32_t min, uint32_t max)
+{
+    // There is no unsigned comparison: flip the sign bit and compare as signed
+    const uint32_t bias = 0x80000000u;
+    const __m256i vBias = _mm256_set1_epi32(static_cast<int32_t>(bias));
+    const __m256i vMin = _mm256_set1_epi32(static_cast<int32_t>(min ^ bias));
+    const __m256i vMax = _mm256_set1_epi32(static_cast<int32_t>(max ^ bias));
+    __m256i outOfRange = _mm256_setzero_si256();
+
+    size_t index = 0;
+    for (; index + 8 <= count; index += 8) {
+
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + index));
+        v = _mm256_xor_si256(v, vBias);
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi32(vMin, v));
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi32(v, vMax));
+    }
+    return _mm256_testz_si256(outOfRange, outOfRange) &&
+           scalar::inRange(values + index, count - index, min, max);
+}
+
+PFW_AVX2 bool inRangeDouble(const double *values, size_t count, double min, double max)
+{
+    const __m256d vMin = _mm256_set1_pd(min);
+    const __m256d vMax = _mm256_set1_pd(max);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m256d v = _mm256_loadu_pd(values + index);
+        // Ordered comparisons: NaN is out of range
+        __m256d inside = _mm256_and_pd(_mm256_cmp_pd(v, vMin, _CMP_GE_OQ),
+                                       _mm256_cmp_pd(v, vMax, _CMP_LE_OQ));
+        if (_mm256_movemask_pd(inside) != 0xF) {
+            return false;
+        }
+    }
+    return scalar::inRange(values + index, count - index, min, max);
+}
+
+PFW_AVX2 bool inRangeFloat(const double *values, size_t count, float min, float max)
+{
+    const __m256d vLowest = _mm256_set1_pd(-FLT_MAX);
+    const __m256d vHighest = _mm256_set1_pd(FLT_MAX);
+    const __m128 vMin = _mm_set1_ps(min);
+    const __m128 vMax = _mm_set1_ps(max);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m256d v = _mm256_loadu_pd(values + index);
+        __m256d representable = _mm256_and_pd(_mm256_cmp_pd(v, vLowest, _CMP_GE_OQ),
+                                              _mm256_cmp_pd(v, vHighest, _CMP_LE_OQ));
+        __m128 converted = _mm256_cvtpd_ps(v);
+        __m128 inside = _mm_and_ps(_mm_cmp_ps(converted, vMin, _CMP_GE_OQ),
+                                   _mm_cmp_ps(converted, vMax, _CMP_LE_OQ));
+        if (_mm256_movemask_pd(representable) != 0xF || _mm_movemask_ps(inside) != 0xF) {
+            return false;
+        }
+    }
+    return scalar::inRangeFloat(values + index, count - index, min, max);
+}
+
+PFW_AVX2 void pack(const uint32_t *values, size_t count, size_t size, uint8_t *dest)
+{
+    const __m128i *src = reinterpret_cast<const __m128i *>(values);
+    size_t index = 0;
+
+    switch (size) {
+    case 1: {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        for (; index + 16 <= count; index += 16, src += 4) {
+
+            // Masking first makes the saturating packs plain truncations
+            __m128i low = _mm_packus_epi32(_mm_and_si128(_mm_loadu_si128(src), mask),
+                                           _mm_and_si128(_mm_loadu_si128(src + 1), mask));
+            __m128i high = _mm_packus_epi32(_mm_and_si128(_mm_loadu_si128(src + 2), mask),
+                                            _mm_and_si128(_mm_loadu_si128(src + 3), mask));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + index),
+                             _mm_packus_epi16(low, high));
+        }
+        break;
+    }
+    case 2: {
+        const __m128i mask = _mm_set1_epi32(0xFFFF);
+        for (; index + 8 <= count; index += 8, src += 2) {
+
+            __m128i packed = _mm_packus_epi32(_mm_and_si128(_mm_loadu_si128(src), mask),
+                                              _mm_and_si128(_mm_loadu_si128(src + 1), mask));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 2 * index), packed);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    scalar::pack(values + index, count - index, size, dest + size * index);
+}
+
+PFW_AVX2 void unpackSigned(const uint8_t *src, size_t count, size_t size, int32_t *values)
+{
+    size_t index = 0;
+
+    switch (size) {
+    case 1:
+        for (; index + 8 <= count; index += 8) {
+
+            __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + index),
+                                _mm256_cvtepi8_epi32(packed));
+        }
+        break;
+    case 2:
+        for (; index + 8 <= count; index += 8) {
+
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + index),
+                                _mm256_cvtepi16_epi32(packed));
+        }
+        break;
+    default:
+        break;
+    }
+    scalar::unpackSigned(src + size * index, count - index, size, values + index);
+}
+
+PFW_AVX2 void unpackUnsigned(const uint8_t *src, size_t count, size_t size, uint32_t *values)
+{
+    size_t index = 0;
+
+    switch (size) {
+    case 1:
+        for (; index + 8 <= count; index += 8) {
+
+            __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + index),
+                                _mm256_cvtepu8_epi32(packed));
+        }
+        break;
+    case 2:
+        for (; index + 8 <= count; index += 8) {
+
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + index),
+                                _mm256_cvtepu16_epi32(packed));
+        }
+        break;
+    default:
+        break;
+    }
+    scalar::unpackUnsigned(src + size * index, count - index, size, values + index);
+}
+
+PFW_AVX2 void doubleToQnm(const double *values, size_t count, const QnmFormat &format,
+                          uint8_t *dest)
+{
+    double scale = qnmScale(format);
+    const __m256d vScale = _mm256_set1_pd(scale);
+    const __m256d vSign = _mm256_set1_pd(-0.0);
+    // Largest double below 0.5: adding it then truncating rounds half away
+    // from zero, as std::round does, without misrounding 0.49999999999999994
+    const __m256d vHalf = _mm256_set1_pd(0.49999999999999994);
+    const __m128i vShift = _mm_cvtsi32_si128(static_cast<int>(format.shift));
+    uint32_t chunk[chunkSize];
+
+    for (size_t first = 0; first < count; first += chunkSize) {
+
+        size_t length = std::min(chunkSize, count - first);
+        size_t index = 0;
+        for (; index + 4 <= length; index += 4) {
+
+            __m256d v = _mm256_mul_pd(_mm256_loadu_pd(values + first + index), vScale);
+            __m256d half = _mm256_or_pd(_mm256_and_pd(v, vSign), vHalf);
+            __m128i rounded = _mm256_cvttpd_epi32(_mm256_add_pd(v, half));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(chunk + index),
+                             _mm_sll_epi32(rounded, vShift));
+        }
+        for (; index < length; ++index) {
+            chunk[index] = scalar::toQnm(values[first + index], scale, format.shift);
+        }
+        pack(chunk, length, format.size, dest + first * format.size);
+    }
+}
+
+PFW_AVX2 void qnmToDouble(const uint8_t *src, size_t count, const QnmFormat &format,
+                          double *values)
+{
+    double scale = qnmScale(format);
+    // Multiplying by a power of two is exact: same result as the scalar division
+    const __m256d vInverse = _mm256_set1_pd(1 / scale);
+    const __m128i vShift = _mm_cvtsi32_si128(static_cast<int>(format.shift));
+    int32_t chunk[chunkSize];
+
+    for (size_t first = 0; first < count; first += chunkSize) {
+
+        size_t length = std::min(chunkSize, count - first);
+        unpackSigned(src + first * format.size, length, format.size, chunk);
+
+        size_t index = 0;
+        for (; index + 4 <= length; index += 4) {
+
+            __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(chunk + index));
+            __m256d v = _mm256_cvtepi32_pd(_mm_sra_epi32(raw, vShift));
+            _mm256_storeu_pd(values + first + index, _mm256_mul_pd(v, vInverse));
+        }
+        for (; index < length; ++index) {
+            values[first + index] = (chunk[index] >> format.shift) / scale;
+        }
+    }
+}
+
+PFW_AVX2 void doubleToFloat(const double *values, size_t count, uint8_t *dest)
+{
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m128 converted = _mm256_cvtpd_ps(_mm256_loadu_pd(values + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + sizeof(float) * index),
+                         _mm_castps_si128(converted));
+    }
+    scalar::doubleToFloat(values + index, count - index, dest + sizeof(float) * index);
+}
+
+PFW_AVX2 void floatToDouble(const uint8_t *src, size_t count, double *values)
+{
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m128i raw =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + sizeof(float) * index));
+        _mm256_storeu_pd(values + index, _mm256_cvtps_pd(_mm_castsi128_ps(raw)));
+    }
+    scalar::floatToDouble(src + sizeof(float) * index, count - index, values + index);
+}
+
+PFW_AVX2 void signedToDouble(const int32_t *values, size_t count, double *results)
+{
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index));
+        _mm256_storeu_pd(results + index, _mm256_cvtepi32_pd(v));
+    }
+    scalar::signedToDouble(values + index, count - index, results + index);
+}
+
+PFW_AVX2 void unsignedToDouble(const uint32_t *values, size_t count, double *results)
+{
+    // Convert as signed with the sign bit flipped, then add back the bias: both exact
+    const __m128i vBias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m256d vDoubleBias = _mm256_set1_pd(2147483648.0);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index));
+        __m256d converted = _mm256_cvtepi32_pd(_mm_xor_si128(v, vBias));
+        _mm256_storeu_pd(results + index, _mm256_add_pd(converted, vDoubleBias));
+    }
+    scalar::unsignedToDouble(values + index, count - index, results + index);
+}
+
+PFW_AVX2 void doubleToSigned(const double *values, size_t count, int32_t *results)
+{
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m128i converted = _mm256_cvttpd_epi32(_mm256_loadu_pd(values + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(results + index), converted);
+    }
+    scalar::doubleToSigned(values + index, count - index, results + index);
+}
+
+PFW_AVX2 void doubleToUnsigned(const double *values, size_t count, uint32_t *results)
+{
+    const __m128i vBias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+    const __m256d vDoubleBias = _mm256_set1_pd(2147483648.0);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m256d v = _mm256_sub_pd(_mm256_loadu_pd(values + index), vDoubleBias);
+        __m128i converted = _mm_xor_si128(_mm256_cvttpd_epi32(v), vBias);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(results + index), converted);
+    }
+    scalar::doubleToUnsigned(values + index, count - index, results + index);
+}
+
+PFW_AVX2 void linearToInteger(const double *values, size_t count, double numerator,
+                              double denominator, double offset, double *results)
+{
+    const __m256d vNumerator = _mm256_set1_pd(numerator);
+    const __m256d vDenominator = _mm256_set1_pd(denominator);
+    const __m256d vOffset = _mm256_set1_pd(offset);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m256d v = _mm256_loadu_pd(values + index);
+        v = _mm256_div_pd(_mm256_mul_pd(v, vNumerator), vDenominator);
+        v = _mm256_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        _mm256_storeu_pd(results + index, _mm256_add_pd(v, vOffset));
+    }
+    scalar::linearToInteger(values + index, count - index, numerator, denominator, offset,
+                            results + index);
+}
+
+PFW_AVX2 void linearFromInteger(const double *values, size_t count, double offset,
+                                double numerator, double denominator, double *results)
+{
+    const __m256d vNumerator = _mm256_set1_pd(numerator);
+    const __m256d vDenominator = _mm256_set1_pd(denominator);
+    const __m256d vOffset = _mm256_set1_pd(offset);
+
+    size_t index = 0;
+    for (; index + 4 <= count; index += 4) {
+
+        __m256d v = _mm256_sub_pd(_mm256_loadu_pd(values + index), vOffset);
+        v = _mm256_div_pd(_mm256_mul_pd(v, vNumerator), vDenominator);
+        _mm256_storeu_pd(results + index, v);
+    }
+    scalar::linearFromInteger(values + index, count - index, offset, numerator, denominator,
+                              results + index);
+}
+
+#undef PFW_AVX2
+
+const Implementation implementation = {
+    "avx2",
+    inRangeSigned,
+    inRangeUnsigned,
+    inRangeDouble,
+    inRangeFloat,
+    pack,
+    unpackSigned,
+    unpackUnsigned,
+    doubleToQnm,
+    qnmToDouble,
+    doubleToFloat,
+    floatToDouble,
+    signedToDouble,
+    unsignedToDouble,
+    doubleToSigned,
+    doubleToUnsigned,
+    linearToInteger,
+    linearFromInteger,
+};
+
+} // namespace avx2
+#endif
+
+const Implementation &selectImplementation()
+{
+#ifdef PFW_KERNELS_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return avx2::implementation;
+    }
+#endif
+    return scalar::implementation;
+}
+
+} // namespace
+
+const Implementation &scalarImplementation()
+{
+    return scalar::implementation;
+}
+
+const Implementation &bestImplementation()
+{
+    static const Implementation &best = selectImplementation();
+    return best;
+}
+
+} // namespace kernels
+} // namespace utility
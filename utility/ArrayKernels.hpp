@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utility
+{
+
+/** Conversion and validation kernels working on whole arrays of values.
+ *
+ * Array parameters are stored in the blackboard as consecutive little endian
+ * integers of 1, 2 or 4 bytes. These kernels convert between such packed
+ * storage and arrays of user values, and check user values against a range.
+ *
+ * Every kernel has a portable scalar implementation. When the CPU supports it,
+ * a vectorized implementation is selected at runtime; both give bit-identical
+ * results.
+ */
+namespace kernels
+{
+
+/** Number of values to convert at once when an intermediate buffer is needed */
+const size_t chunkSize = 256;
+
+/** Description of a Qn.m fixed point blackboard storage */
+struct QnmFormat
+{
+    /** Storage size of one value, in bytes (1, 2 or 4) */
+    size_t size;
+    /** Number of fractional bits (the "m" of Qn.m) */
+    uint32_t fractional;
+    /** Number of unused low bits: values are left justified in their storage */
+    uint32_t shift;
+};
+
+/** Set of kernels
+ *
+ * A range check returns true if all values lie in [min, max]; NaN is never in
+ * range. Packing truncates values to the storage size, unpacking sign or zero
+ * extends them.
+ */
+struct Implementation
+{
+    /** Human readable name, for diagnostics */
+    const char *name;
+
+    bool (*inRangeSigned)(const int32_t *values, size_t count, int32_t min, int32_t max);
+    bool (*inRangeUnsigned)(const uint32_t *values, size_t count, uint32_t min, uint32_t max);
+    bool (*inRangeDouble)(const double *values, size_t count, double min, double max);
+    /** Checks that values are representable as float and, once converted, lie in range */
+    bool (*inRangeFloat)(const double *values, size_t count, float min, float max);
+
+    void (*pack)(const uint32_t *values, size_t count, size_t size, uint8_t *dest);
+    void (*unpackSigned)(const uint8_t *src, size_t count, size_t size, int32_t *values);
+    void (*unpackUnsigned)(const uint8_t *src, size_t count, size_t size, uint32_t *values);
+
+    /** Converts to Qn.m, rounding half away from zero. Values must be in range. */
+    void (*doubleToQnm)(const double *values, size_t count, const QnmFormat &format,
+                        uint8_t *dest);
+    void (*qnmToDouble)(const uint8_t *src, size_t count, const QnmFormat &format,
+                        double *values);
+
+    void (*doubleToFloat)(const double *values, size_t count, uint8_t *dest);
+    void (*floatToDouble)(const uint8_t *src, size_t count, double *values);
+
+    /** Integers are converted exactly; doubles must be integers in range */
+    void (*signedToDouble)(const int32_t *values, size_t count, double *results);
+    void (*unsignedToDouble)(const uint32_t *values, size_t count, double *results);
+    void (*doubleToSigned)(const double *values, size_t count, int32_t *results);
+    void (*doubleToUnsigned)(const double *values, size_t count, uint32_t *results);
+
+    /** Computes trunc(value * numerator / denominator) + offset
+     *
+     * Can work in place (values == results).
+     */
+    void (*linearToInteger)(const double *values, size_t count, double numerator,
+                            double denominator, double offset, double *results);
+    /** Computes (value - offset) * numerator / denominator
+     *
+     * Can work in place (values == results).
+     */
+    void (*linearFromInteger)(const double *values, size_t count, double offset,
+                              double numerator, double denominator, double *results);
+};
+
+/** @return the portable implementation */
+const Implementation &scalarImplementation();
+
+/** @return the fastest implementation supported by the running CPU */
+const Implementation &bestImplementation();
+
+inline bool inRange(const int32_t *values, size_t count, int32_t min, int32_t max)
+{
+    return bestImplementation().inRangeSigned(values, count, min, max);
+}
+
+inline bool inRange(const uint32_t *values, size_t count, uint32_t min, uint32_t max)
+{
+    return bestImplementation().inRangeUnsigned(values, count, min, max);
+}
+
+inline bool inRange(const double *values, size_t count, double min, double max)
+{
+    return bestImplementation().inRangeDouble(values, count, min, max);
+}
+
+inline bool inFloatRange(const double *values, size_t count, float min, float max)
+{
+    return bestImplementation().inRangeFloat(values, count, min, max);
+}
+
+inline void pack(const uint32_t *values, size_t count, size_t size, uint8_t *dest)
+{
+    bestImplementation().pack(values, count, size, dest);
+}
+
+inline void pack(const int32_t *values, size_t count, size_t size, uint8_t *dest)
+{
+    // Truncation is identical for signed and unsigned values
+    bestImplementation().pack(reinterpret_cast<const uint32_t *>(values), count, size, dest);
+}
+
+inline void unpack(const uint8_t *src, size_t count, size_t size, int32_t *values)
+{
+    bestImplementation().unpackSigned(src, count, size, values);
+}
+
+inline void unpack(const uint8_t *src, size_t count, size_t size, uint32_t *values)
+{
+    bestImplementation().unpackUnsigned(src, count, size, values);
+}
+
+inline void doubleToQnm(const double *values, size_t count, const QnmFormat &format,
+                        uint8_t *dest)
+{
+    bestImplementation().doubleToQnm(values, count, format, dest);
+}
+
+inline void qnmToDouble(const uint8_t *src, size_t count, const QnmFormat &format, double *values)
+{
+    bestImplementation().qnmToDouble(src, count, format, values);
+}
+
+inline void doubleToFloat(const double *values, size_t count, uint8_t *dest)
+{
+    bestImplementation().doubleToFloat(values, count, dest);
+}
+
+inline void floatToDouble(const uint8_t *src, size_t count, double *values)
+{
+    bestImplementation().floatToDouble(src, count, values);
+}
+
+inline void toDouble(const int32_t *values, size_t count, double *results)
+{
+    bestImplementation().signedToDouble(values, count, results);
+}
+
+inline void toDouble(const uint32_t *values, size_t count, double *results)
+{
+    bestImplementation().unsignedToDouble(values, count, results);
+}
+
+inline void toInteger(const double *values, size_t count, int32_t *results)
+{
+    bestImplementation().doubleToSigned(values, count, results);
+}
+
+inline void toInteger(const double *values, size_t count, uint32_t *results)
+{
+    bestImplementation().doubleToUnsigned(values, count, results);
+}
+
+inline void linearToInteger(const double *values, size_t count, double numerator,
+                            double denominator, double offset, double *results)
+{
+    bestImplementation().linearToInteger(values, count, numerator, denominator, offset, results);
+}
+
+inline void linearFromInteger(const double *values, size_t count, double offset,
+                              double numerator, double denominator, double *results)
+{
+    bestImplementation().linearFromInteger(values, count, offset, numerator, denominator, results);
+}
+
+} // namespace kernels
+} // namespace utility
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "CriterionTrace.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace utility
+{
+namespace criterionTrace
+{
+
+static const char magic[] = {'P', 'F', 'W', 'C', 'R', 'I', 'T', '1'};
+
+/** Maximum length of a string, to reject corrupted traces rather than allocating */
+static const uint64_t maxStringLength = 1 << 20;
+
+bool Writer::open(const std::string &path, std::string &error)
+{
+    close();
+    mFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!mFile.is_open()) {
+        error = "Could not create criterion trace file " + path;
+        return false;
+    }
+    mFile.write(magic, sizeof(magic));
+    mStart = std::chrono::steady_clock::now();
+    mLastTime = 0;
+    return true;
+}
+
+void Writer::close()
+{
+    if (mFile.is_open()) {
+        mFile.close();
+    }
+}
+
+void Writer::define(const Definition &definition)
+{
+    mFile.put('D');
+    writeString(definition.name);
+    mFile.put(definition.bInclusive ? 1 : 0);
+    writeVarint(definition.valuePairs.size());
+    for (auto &valuePair : definition.valuePairs) {
+        writeSigned(valuePair.first);
+        writeString(valuePair.second);
+    }
+    writeSigned(definition.state);
+}
+
+void Writer::change(size_t criterion, int state)
+{
+    mFile.put('S');
+    writeTime();
+    writeVarint(criterion);
+    writeSigned(state);
+}
+
+void Writer::apply()
+{
+    mFile.put('A');
+    writeTime();
+    // Applications are rare enough to keep the file readable after a crash
+    mFile.flush();
+}
+
+void Writer::writeTime()
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    auto time = static_cast<uint64_t>(
+        duration_cast<microseconds>(std::chrono::steady_clock::now() - mStart).count());
+    writeVarint(time - mLastTime);
+    mLastTime = time;
+}
+
+void Writer::writeVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        mFile.put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    mFile.put(static_cast<char>(value));
+}
+
+void Writer::writeSigned(int value)
+{
+    // Zigzag encoding so that small negative values are short
+    auto wide = static_cast<int64_t>(value);
+    writeVarint(static_cast<uint64_t>((wide << 1) ^ (wide >> 63)));
+}
+
+void Writer::writeString(const std::string &str)
+{
+    writeVarint(str.size());
+    mFile.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+bool Reader::read(const std::string &path, std::string &error)
+{
+    mDefinitions.clear();
+    mEvents.clear();
+
+    std::ifstream input(path, std::ios::binary);
+    if (!input.is_open()) {
+        error = "Could not open criterion trace file " + path;
+        return false;
+    }
+    char header[sizeof(magic)];
+    if (!input.read(header, sizeof(header)) ||
+        !std::equal(std::begin(magic), std::end(magic), header)) {
+        error = path + " is not a criterion trace file";
+        return false;
+    }
+
+    uint64_t time = 0;
+    char type;
+    while (input.get(type)) {
+
+        bool bValid = true;
+        if (type == 'D') {
+
+            Definition definition;
+            uint64_t count = 0;
+            bValid = readString(input, definition.name) && input.get(type) &&
+                     readVarint(input, count) && count <= maxStringLength;
+            definition.bInclusive = type != 0;
+            for (uint64_t pair = 0; bValid && pair < count; pair++) {
+                int value;
+                std::string literal;
+                bValid = readSigned(input, value) && readString(input, literal);
+                definition.valuePairs.emplace_back(value, literal);
+            }
+            bValid = bValid && readSigned(input, definition.state) && mEvents.empty();
+            mDefinitions.push_back(definition);
+        } else if (type == 'S' || type == 'A') {
+
+            Event event{type == 'A', 0, 0, 0};
+            uint64_t delta = 0;
+            uint64_t criterion = 0;
+            bValid = readVarint(input, delta);
+            if (bValid && !event.bApply) {
+                bValid = readVarint(input, criterion) && criterion < mDefinitions.size() &&
+                         readSigned(input, event.state);
+            }
+            time += delta;
+            event.time = time;
+            event.criterion = static_cast<size_t>(criterion);
+            mEvents.push_back(event);
+        } else {
+            bValid = false;
+        }
+        if (!bValid) {
+            error = path + ": invalid or truncated criterion trace record";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Reader::readVarint(std::istream &input, uint64_t &value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        char byte;
+        if (!input.get(byte)) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(byte) & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Reader::readSigned(std::istream &input, int &value)
+{
+    uint64_t encoded;
+    if (!readVarint(input, encoded)) {
+        return false;
+    }
+    auto magnitude = static_cast<int64_t>(encoded >> 1);
+    value = static_cast<int>(magnitude ^ -static_cast<int64_t>(encoded & 1));
+    return true;
+}
+
+bool Reader::readString(std::istream &input, std::string &str)
+{
+    uint64_t length;
+    if (!readVarint(input, length) || length > maxStringLength) {
+        return false;
+    }
+    str.resize(static_cast<size_t>(length));
+    return length == 0 || input.read(&str[0], static_cast<std::streamsize>(length));
+}
+
+} // namespace criterionTrace
+} // namespace utility
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace utility
+{
+
+/** Compact binary trace of criterion changes and configuration applications
+ *
+ * The file starts with the 8 bytes magic "PFWCRIT1", followed by records each starting
+ * with a type byte:
+ * - 'D', criterion definition: name, inclusive flag byte, value pair count, value pairs
+ *   (value then literal) and state when the recording started,
+ * - 'S', criterion change: time, criterion index in definition order, new state,
+ * - 'A', configuration application: time.
+ *
+ * Counts and indexes are unsigned LEB128 varints, values and states are zigzag encoded
+ * varints, strings are a length then their bytes. Times are varint deltas in microseconds
+ * from the previous record time, the recording start being the time origin.
+ */
+namespace criterionTrace
+{
+
+using ValuePairs = std::vector<std::pair<int, std::string>>;
+
+struct Definition
+{
+    std::string name;
+    bool bInclusive;
+    ValuePairs valuePairs;
+    int state;
+};
+
+struct Event
+{
+    /** true for a configuration application, false for a criterion change */
+    bool bApply;
+    /** Microseconds since the recording start */
+    uint64_t time;
+    /** Criterion index in definition order, for changes only */
+    size_t criterion;
+    /** New state, for changes only */
+    int state;
+};
+
+/** Write a trace file. Not thread safe. */
+class Writer : private NonCopyable
+{
+public:
+    /** @return false, filling error, if the file can not be created */
+    bool open(const std::string &path, std::string &error);
+    void close();
+    bool isOpen() const { return mFile.is_open(); }
+
+    /** Define the next criterion, all definitions must be written before any event */
+    void define(const Definition &definition);
+    void change(size_t criterion, int state);
+    void apply();
+
+private:
+    /** Write the delta from the previous record time */
+    void writeTime();
+    void writeVarint(uint64_t value);
+    void writeSigned(int value);
+    void writeString(const std::string &str);
+
+    std::ofstream mFile;
+    std::chrono::steady_clock::time_point mStart;
+    uint64_t mLastTime = 0;
+};
+
+/** Read a whole trace file */
+class Reader
+{
+public:
+    /** @return false, filling error, if the file can not be read or is not a valid trace */
+    bool read(const std::string &path, std::string &error);
+
+    const std::vector<Definition> &getDefinitions() const { return mDefinitions; }
+    const std::vector<Event> &getEvents() const { return mEvents; }
+
+private:
+    bool readVarint(std::istream &input, uint64_t &value);
+    bool readSigned(std::istream &input, int &value);
+    bool readString(std::istream &input, std::string &str);
+
+    std::vector<Definition> mDefinitions;
+    std::vector<Event> mEvents;
+};
+
+} // namespace criterionTrace
+} // namespace utility
@@ -39,40 +39,90 @@ Tokenizer::Tokenizer(const string &input, const string &delimiters, bool mergeDe
 {
 }
 
+Tokenizer::Tokenizer(string &&input, const string &delimiters, bool mergeDelimiters)
+    : _ownedInput(std::move(input)), _input(_ownedInput), _delimiters(delimiters),
+      _mergeDelimiters(mergeDelimiters)
+{
+}
+
 vector<string> Tokenizer::split()
 {
     vector<string> result;
-    string token;
-    bool leftover = false;
-
-    for (const auto character : _input) {
-        if (_delimiters.find(character) != string::npos) {
-            if (_mergeDelimiters) {
-                leftover = false;
-                if (token.empty()) {
-                    // skip consecutive delimiters
-                    continue;
-                }
-            } else {
-                // We've encountered a delimiter, which means that there is a
-                // left-hand token and a right-side token. We are going to add
-                // the left-hand one but must not forget that there is a
-                // right-hand one (possibly empty)
-                leftover = true;
-            }
-
-            result.push_back(token);
-            token.clear();
-            continue;
+    size_t first;
+    size_t length;
+
+    while (next(first, length)) {
+        result.push_back(_input.substr(first, length));
+    }
+
+    return result;
+}
+
+bool Tokenizer::next(size_t &first, size_t &length)
+{
+    return findToken(_position, _done, first, length);
+}
+
+bool Tokenizer::next(string &token)
+{
+    size_t first;
+    size_t length;
+
+    if (!next(first, length)) {
+        return false;
+    }
+    token.assign(_input, first, length);
+    return true;
+}
+
+size_t Tokenizer::remaining() const
+{
+    size_t position = _position;
+    bool done = _done;
+    size_t first;
+    size_t length;
+    size_t count = 0;
+
+    while (findToken(position, done, first, length)) {
+        ++count;
+    }
+    return count;
+}
+
+bool Tokenizer::findToken(size_t &position, bool &done, size_t &first, size_t &length) const
+{
+    if (done) {
+        return false;
+    }
+
+    if (_mergeDelimiters) {
+        // skip consecutive delimiters
+        first = _input.find_first_not_of(_delimiters, position);
+        if (first == string::npos) {
+            done = true;
+            return false;
+        }
+    } else {
+        if (_input.empty()) {
+            done = true;
+            return false;
         }
-        token += character;
-        leftover = true;
+        first = position;
     }
 
-    // push any leftover token:
-    if (leftover) {
-        result.push_back(token);
+    size_t last = _input.find_first_of(_delimiters, first);
+    if (last == string::npos) {
+        // This is the last token
+        done = true;
+        last = _input.size();
+    } else if (!_mergeDelimiters) {
+        // We've encountered a delimiter, which means that there is a
+        // left-hand token and a right-side token (possibly empty)
+        position = last + 1;
+    } else {
+        position = last;
     }
 
-    return result;
+    length = last - first;
+    return true;
 }
@@ -38,11 +38,16 @@
  *
  * Must be initialized with a string to be tokenized and, optionally, a string
  * of delimiters (@see Tokenizer::defaultDelimiters).
+ *
+ * Tokens can either be all retrieved at once (@see split) or read one by one
+ * (@see next), which does not copy the input string.
  */
 class Tokenizer : private utility::NonCopyable
 {
 public:
     /** Constructs a Tokenizer
+     *
+     * The input string is not copied: it must outlive the tokenizer.
      *
      * @param[in] input The string to be tokenized
      * @param[in] delimiters A string containing all the token delimiters
@@ -53,17 +58,51 @@ public:
      */
     Tokenizer(const std::string &input, const std::string &delimiters = defaultDelimiters,
               bool mergeDelimiters = true);
+
+    /** Constructs a Tokenizer owning a temporary input string
+     *
+     * @see Tokenizer(const std::string &, const std::string &, bool)
+     */
+    Tokenizer(std::string &&input, const std::string &delimiters = defaultDelimiters,
+              bool mergeDelimiters = true);
     ~Tokenizer(){};
 
     /** Return a vector of all tokens
      */
     std::vector<std::string> split();
 
+    /** Reads the next token, without copying it
+     *
+     * @param[out] first The position of the token in the input string
+     * @param[out] length The length of the token
+     *
+     * @return false if all tokens have been read, true otherwise
+     */
+    bool next(size_t &first, size_t &length);
+
+    /** Reads the next token into a string, reusing its storage
+     *
+     * @param[out] token The token
+     *
+     * @return false if all tokens have been read, true otherwise
+     */
+    bool next(std::string &token);
+
+    /** Return the number of tokens not read yet, without reading them
+     */
+    size_t remaining() const;
+
     /** Default list of delimiters (" \n\r\t\v\f") */
     static const std::string defaultDelimiters;
 
 private:
-    const std::string _input;      //< string to be tokenized
-    const std::string _delimiters; //< token delimiters
-    const bool _mergeDelimiters;   //< whether subsequent delimiters should be merged
+    /** Finds the token starting at position and moves position after it */
+    bool findToken(size_t &position, bool &done, size_t &first, size_t &length) const;
+
+    const std::string _ownedInput;  //< storage of temporary inputs
+    const std::string &_input;      //< string to be tokenized
+    const std::string _delimiters;  //< token delimiters
+    const bool _mergeDelimiters;    //< whether subsequent delimiters should be merged
+    size_t _position{0};            //< where to look for the next token
+    bool _done{false};              //< whether all tokens have been read
 };
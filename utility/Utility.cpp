@@ -33,6 +33,9 @@
 #include <sstream>
 #include <iterator>
 #include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <cstring>
 
 using std::string;
 
@@ -62,4 +65,87 @@ bool isHexadecimal(const string &strValue)
     return (strValue.compare(0, 2, "0x") == 0) or (strValue.compare(0, 2, "0X") == 0);
 }
 
+string toHexadecimal(uint64_t value, size_t minDigits)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    const size_t maxDigits = 2 * sizeof(value);
+
+    // Fill the buffer from its end
+    char buffer[2 + maxDigits];
+    char *first = buffer + sizeof(buffer);
+    do {
+        *--first = digits[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+
+    size_t padding = std::min(minDigits, maxDigits);
+    while (buffer + sizeof(buffer) - first < static_cast<ptrdiff_t>(padding)) {
+        *--first = '0';
+    }
+    *--first = 'x';
+    *--first = '0';
+
+    return string(first, buffer + sizeof(buffer));
+}
+
+string formatFloatingPoint(double value, int precision, bool fixed)
+{
+    const char *format = fixed ? "%.*f" : "%.*g";
+    char buffer[64];
+
+    int length = snprintf(buffer, sizeof(buffer), format, precision, value);
+    if (length < 0) {
+        return "";
+    }
+    string result;
+    if (static_cast<size_t>(length) < sizeof(buffer)) {
+        result.assign(buffer, static_cast<size_t>(length));
+    } else {
+        // Only happens for huge fixed values
+        result.resize(static_cast<size_t>(length) + 1);
+        snprintf(&result[0], result.size(), format, precision, value);
+        result.resize(static_cast<size_t>(length));
+    }
+
+    // printf follows the locale set by the application
+    const char *point = localeconv()->decimal_point;
+    if (strcmp(point, ".") != 0) {
+        size_t position = result.find(point);
+        if (position != string::npos) {
+            result.replace(position, strlen(point), ".");
+        }
+    }
+    return result;
+}
+
+string asJsonString(const string &str)
+{
+    string result = "\"";
+    for (char character : str) {
+        switch (character) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+                result += "\\u00";
+                result += "0123456789abcdef"[(character >> 4) & 0xF];
+                result += "0123456789abcdef"[character & 0xF];
+            } else {
+                result += character;
+            }
+        }
+    }
+    return result + '"';
+}
+
 } // namespace utility
@@ -32,6 +32,8 @@
 
 #include <string>
 #include <list>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <sstream>
 #include <numeric>
@@ -109,4 +111,37 @@ void appendTitle(std::string &strTo, const std::string &strTitle);
  */
 bool isHexadecimal(const std::string &strValue);
 
+/**
+ * Formats an integer as "0x" followed by its uppercase hexadecimal digits.
+ *
+ * Gives the same result as streaming the value with std::hex, std::uppercase
+ * and zero filling, without creating a stream.
+ *
+ * @param[in] value the value to format
+ * @param[in] minDigits the minimal number of digits, zero padded
+ *
+ * @return the formatted value.
+ */
+std::string toHexadecimal(uint64_t value, size_t minDigits = 0);
+
+/**
+ * Formats a floating point number as a stream in the classic locale would.
+ *
+ * @param[in] value the value to format
+ * @param[in] precision significant digits, or digits after the point if fixed
+ * @param[in] fixed true for std::fixed notation, false for the default one
+ *
+ * @return the formatted value.
+ */
+std::string formatFloatingPoint(double value, int precision, bool fixed = false);
+
+/**
+ * Formats a string as a JSON string literal.
+ *
+ * @param[in] str the string to format
+ *
+ * @return the quoted string, with quotes, backslashes and control characters escaped.
+ */
+std::string asJsonString(const std::string &str);
+
 } // namespace utility
@@ -34,7 +34,10 @@
 #include <sstream>
 #include <string>
 #include <stdint.h>
+#include <cerrno>
+#include <clocale>
 #include <cmath>
+#include <cstdlib>
 #include <type_traits>
 
 /* details namespace is here to hide implementation details to header end user. It
@@ -42,6 +45,8 @@
 namespace details
 {
 
+static const auto npos = std::string::npos;
+
 /* List of allowed types for conversion */
 template <typename T>
 struct ConvertionAllowed : std::false_type
@@ -114,30 +119,16 @@ struct ConvertionAllowedVia<signed char, int> : std::true_type
 {
 };
 
+/* Legacy conversion through a string stream, which always parses in the
+ * classic locale. Only used when the C library parsing functions would not. */
 template <typename T>
-static inline bool convertTo(const std::string &str, T &result)
+static inline bool convertWithStream(const std::string &str, T &result)
 {
-    /* Check that conversion to that type is allowed.
-     * If this fails, this means that this template was not intended to be used
-     * with this type, thus that the result is undefined. */
-    static_assert(ConvertionAllowed<T>::value, "convertTo does not support this conversion");
-
-    if (str.find_first_of(std::string("\r\n\t\v ")) != std::string::npos) {
-        return false;
-    }
-
-    /* Check for a '-' in string. If type is unsigned and a - is found, the
-     * parsing fails. This is made necessary because "-1" is read as 65535 for
-     * uint16_t, for example */
-    if (str.find("-") != std::string::npos && !std::numeric_limits<T>::is_signed) {
-        return false;
-    }
-
     std::stringstream ss(str);
 
     /* Sadly, the stream conversion does not handle hexadecimal format, thus
      * check is done manually */
-    if (str.substr(0, 2) == "0x") {
+    if (str.compare(0, 2, "0x") == 0) {
         if (std::numeric_limits<T>::is_integer) {
             ss >> std::hex >> result;
         } else {
@@ -151,6 +142,118 @@ static inline bool convertTo(const std::string &str, T &result)
     return ss.eof() && !ss.fail() && !ss.bad();
 }
 
+/* Parse the whole string with the C library, which does not allocate. */
+static inline bool parse(const char *str, int base, long long &result)
+{
+    char *end;
+    errno = 0;
+    result = strtoll(str, &end, base);
+    return end != str && *end == '\0' && errno != ERANGE;
+}
+
+static inline bool parse(const char *str, int base, unsigned long long &result)
+{
+    char *end;
+    errno = 0;
+    result = strtoull(str, &end, base);
+    return end != str && *end == '\0' && errno != ERANGE;
+}
+
+/* Overflows are reported as infinite results, rejected by convertTo */
+static inline bool parse(const char *str, float &result)
+{
+    char *end;
+    result = strtof(str, &end);
+    return end != str && *end == '\0';
+}
+
+static inline bool parse(const char *str, double &result)
+{
+    char *end;
+    result = strtod(str, &end);
+    return end != str && *end == '\0';
+}
+
+template <typename T>
+static inline bool fits(long long value)
+{
+    return value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max();
+}
+
+template <typename T>
+static inline bool fits(unsigned long long value)
+{
+    return value <= std::numeric_limits<T>::max();
+}
+
+/* Integer conversion */
+template <typename T>
+static inline bool convertNumberTo(const std::string &str, T &result, std::true_type)
+{
+    using Parsed = typename std::conditional<std::numeric_limits<T>::is_signed, long long,
+                                             unsigned long long>::type;
+    const char *digits = str.c_str();
+    int base = 10;
+
+    if (str.compare(0, 2, "0x") == 0) {
+
+        /* Only digits may follow the prefix: strtoll would also accept a sign,
+         * spaces or a second prefix */
+        if (str.size() == 2 || str.find_first_not_of("0123456789abcdefABCDEF", 2) != npos) {
+            return false;
+        }
+        digits += 2;
+        base = 16;
+    }
+
+    Parsed parsed;
+    if (!parse(digits, base, parsed) || !fits<T>(parsed)) {
+        return false;
+    }
+    result = static_cast<T>(parsed);
+    return true;
+}
+
+/* Floating point conversion */
+template <typename T>
+static inline bool convertNumberTo(const std::string &str, T &result, std::false_type)
+{
+    /* strtod also accepts hexadecimal floats, infinities and NaN: stick to the
+     * decimal syntax of streams */
+    if (str.find_first_not_of("0123456789+-.eE\f") != npos) {
+        return false;
+    }
+
+    /* The C library follows the locale set by the application */
+    if (*localeconv()->decimal_point != '.') {
+        return convertWithStream(str, result);
+    }
+    return parse(str.c_str(), result);
+}
+
+template <typename T>
+static inline bool convertTo(const std::string &str, T &result)
+{
+    /* Check that conversion to that type is allowed.
+     * If this fails, this means that this template was not intended to be used
+     * with this type, thus that the result is undefined. */
+    static_assert(ConvertionAllowed<T>::value, "convertTo does not support this conversion");
+
+    if (str.find_first_of("\r\n\t\v ") != npos) {
+        return false;
+    }
+
+    /* Check for a '-' in string. If type is unsigned and a - is found, the
+     * parsing fails. This is made necessary because "-1" is read as 65535 for
+     * uint16_t, for example */
+    if (str.find('-') != npos && !std::numeric_limits<T>::is_signed) {
+        return false;
+    }
+
+    using IsInteger = std::integral_constant<bool, std::numeric_limits<T>::is_integer>;
+    return convertNumberTo(str, result, IsInteger{});
+}
+
 template <typename T, typename Via>
 static inline bool convertToVia(const std::string &str, T &result)
 {
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "convert.hpp"
+
+#include <catch.hpp>
+#include <string>
+
+using std::string;
+
+template <class T>
+struct ConvertTest
+{
+    string input;
+    bool success;
+    T result;
+};
+
+template <class T>
+static void checkConvert(const std::initializer_list<ConvertTest<T>> &tests)
+{
+    for (auto &test : tests) {
+        CAPTURE(test.input);
+        T result{};
+        REQUIRE(convertTo(test.input, result) == test.success);
+        if (test.success) {
+            CHECK(result == test.result);
+        }
+    }
+}
+
+SCENARIO("convertTo integers")
+{
+    checkConvert<int32_t>({{"0", true, 0},
+                           {"42", true, 42},
+                           {"+42", true, 42},
+                           {"-42", true, -42},
+                           {"007", true, 7},
+                           {"2147483647", true, 2147483647},
+                           {"-2147483648", true, -2147483647 - 1},
+                           {"2147483648", false, 0},
+                           {"-2147483649", false, 0},
+                           {"0x7fffFFFF", true, 0x7fffffff},
+                           {"0x80000000", false, 0},
+                           {"0X10", false, 0},
+                           {"0x", false, 0},
+                           {"0x0x5", false, 0},
+                           {"0x-1", false, 0},
+                           {"0x+1", false, 0},
+                           {"-0x1", false, 0},
+                           {"0xG", false, 0},
+                           {"", false, 0},
+                           {"-", false, 0},
+                           {"+-1", false, 0},
+                           {"1.5", false, 0},
+                           {"1e3", false, 0},
+                           {" 1", false, 0},
+                           {"1 ", false, 0},
+                           {"1\n", false, 0},
+                           {"\t1", false, 0},
+                           {"12abc", false, 0}});
+    checkConvert<uint32_t>({{"4294967295", true, 4294967295u},
+                            {"4294967296", false, 0},
+                            {"0xFFFFFFFF", true, 0xffffffffu},
+                            {"0x100000000", false, 0},
+                            {"+5", true, 5},
+                            {"-0", false, 0},
+                            {"-1", false, 0}});
+    checkConvert<int16_t>({{"32767", true, 32767},
+                           {"32768", false, 0},
+                           {"-32768", true, -32768},
+                           {"0x7FFF", true, 0x7fff},
+                           {"0xFFFF", false, 0}});
+    checkConvert<uint16_t>({{"65535", true, 65535}, {"65536", false, 0}, {"0xffff", true, 0xffff}});
+    checkConvert<int8_t>({{"127", true, 127}, {"-128", true, -128}, {"128", false, 0}});
+    checkConvert<uint8_t>({{"255", true, 255}, {"256", false, 0}, {"0xFF", true, 255}});
+    checkConvert<int64_t>({{"-9223372036854775808", true, INT64_MIN},
+                           {"9223372036854775808", false, 0},
+                           {"0x7FFFFFFFFFFFFFFF", true, INT64_MAX}});
+    checkConvert<uint64_t>({{"18446744073709551615", true, UINT64_MAX},
+                            {"18446744073709551616", false, 0},
+                            {"0xFFFFFFFFFFFFFFFF", true, UINT64_MAX}});
+}
+
+SCENARIO("convertTo floating points")
+{
+    checkConvert<double>({{"0", true, 0},
+                          {"1.5", true, 1.5},
+                          {"-1.5", true, -1.5},
+                          {"+.5", true, .5},
+                          {"1.", true, 1},
+                          {"1e3", true, 1e3},
+                          {"1E-3", true, 1e-3},
+                          {"1e+3", true, 1e3},
+                          {"1e400", false, 0},
+                          {"-1e400", false, 0},
+                          {"1e", false, 0},
+                          {".", false, 0},
+                          {"e5", false, 0},
+                          {"0x10", false, 0},
+                          {"0X1p3", false, 0},
+                          {"inf", false, 0},
+                          {"-INF", false, 0},
+                          {"infinity", false, 0},
+                          {"nan", false, 0},
+                          {"1,5", false, 0},
+                          {" 1.5", false, 0},
+                          {"1.5 ", false, 0},
+                          {"", false, 0}});
+    checkConvert<float>({{"1.25", true, 1.25f},
+                         {"3.4e38", true, 3.4e38f},
+                         {"3.5e38", false, 0},
+                         {"0.1", true, 0.1f},
+                         {"nan", false, 0}});
+}
+
+SCENARIO("convertTo booleans")
+{
+    checkConvert<bool>({{"0", true, false},
+                        {"1", true, true},
+                        {"true", true, true},
+                        {"TRUE", true, true},
+                        {"false", true, false},
+                        {"FALSE", true, false},
+                        {"True", false, false},
+                        {"2", false, false},
+                        {"", false, false}});
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CriterionTrace.h"
+#include "TmpFile.hpp"
+
+#include <catch.hpp>
+
+#include <fstream>
+#include <string>
+
+using namespace utility::criterionTrace;
+using parameterFramework::utility::TmpFile;
+
+SCENARIO("Criterion trace round trip", "[criterion trace]")
+{
+    TmpFile file("");
+    std::string error;
+
+    GIVEN ("A trace written with definitions, changes and applications") {
+        Writer writer;
+        REQUIRE(writer.open(file.getPath(), error));
+        writer.define({"Mode", false, {{0, "Off"}, {1, "On"}, {-300, "Negative"}}, 1});
+        writer.define({"Devices", true, {{1, "Speaker"}, {0x40000000, "Headset"}}, 0});
+        writer.change(0, -300);
+        writer.change(1, 0x40000001);
+        writer.apply();
+        writer.close();
+
+        THEN ("Reading it should give back what was written") {
+            Reader reader;
+            REQUIRE(reader.read(file.getPath(), error));
+
+            auto &definitions = reader.getDefinitions();
+            REQUIRE(definitions.size() == 2);
+            CHECK(definitions[0].name == "Mode");
+            CHECK_FALSE(definitions[0].bInclusive);
+            CHECK(definitions[0].valuePairs ==
+                  (ValuePairs{{0, "Off"}, {1, "On"}, {-300, "Negative"}}));
+            CHECK(definitions[0].state == 1);
+            CHECK(definitions[1].name == "Devices");
+            CHECK(definitions[1].bInclusive);
+
+            auto &events = reader.getEvents();
+            REQUIRE(events.size() == 3);
+            CHECK_FALSE(events[0].bApply);
+            CHECK(events[0].criterion == 0);
+            CHECK(events[0].state == -300);
+            CHECK(events[1].criterion == 1);
+            CHECK(events[1].state == 0x40000001);
+            CHECK(events[2].bApply);
+            CHECK(events[0].time <= events[1].time);
+            CHECK(events[1].time <= events[2].time);
+        }
+        WHEN ("The trace is truncated") {
+            std::ifstream input(file.getPath(), std::ios::binary);
+            std::string content((std::istreambuf_iterator<char>(input)),
+                                std::istreambuf_iterator<char>());
+            TmpFile truncated(content.substr(0, content.size() - 4));
+            THEN ("Reading it should fail") {
+                Reader reader;
+                CHECK_FALSE(reader.read(truncated.getPath(), error));
+            }
+        }
+    }
+    GIVEN ("A file which is not a trace") {
+        TmpFile other("<xml/>");
+        THEN ("Reading it should fail") {
+            Reader reader;
+            CHECK_FALSE(reader.read(other.getPath(), error));
+        }
+    }
+}
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ArrayKernels.hpp"
+
+#include <catch.hpp>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using std::vector;
+
+namespace utility
+{
+namespace kernels
+{
+
+// Lengths exercising both full vectors and remainders
+static const vector<size_t> lengths = {0, 1, 3, 4, 7, 8, 15, 16, 17, 63, 64, 65, 130};
+
+static vector<uint32_t> integers(size_t length)
+{
+    vector<uint32_t> values(length);
+    uint32_t seed = 0x12345678;
+    for (auto &value : values) {
+        // Linear congruential generator: deterministic, covers all bit patterns
+        seed = seed * 1664525u + 1013904223u;
+        value = seed;
+    }
+    return values;
+}
+
+static vector<double> reals(size_t length, double amplitude)
+{
+    vector<double> values(length);
+    for (size_t index = 0; index < length; ++index) {
+        values[index] = amplitude * std::sin(static_cast<double>(index) * 0.37);
+    }
+    return values;
+}
+
+SCENARIO("Array kernel range checks")
+{
+    const Implementation &scalar = scalarImplementation();
+    const Implementation &best = bestImplementation();
+    CAPTURE(best.name);
+
+    for (auto length : lengths) {
+        CAPTURE(length);
+        auto values = integers(length);
+        auto signedValues = vector<int32_t>(values.begin(), values.end());
+        auto doubles = reals(length, 10);
+
+        THEN ("All values are in the full range") {
+            CHECK(best.inRangeUnsigned(values.data(), length, 0, UINT32_MAX));
+            CHECK(best.inRangeSigned(signedValues.data(), length, INT32_MIN, INT32_MAX));
+            CHECK(best.inRangeDouble(doubles.data(), length, -10, 10));
+            CHECK(best.inRangeFloat(doubles.data(), length, -10, 10));
+        }
+        THEN ("Both implementations agree on a narrower range") {
+            CHECK(best.inRangeUnsigned(values.data(), length, 1u << 30, 3u << 30) ==
+                  scalar.inRangeUnsigned(values.data(), length, 1u << 30, 3u << 30));
+            CHECK(best.inRangeSigned(signedValues.data(), length, -(1 << 30), 1 << 30) ==
+                  scalar.inRangeSigned(signedValues.data(), length, -(1 << 30), 1 << 30));
+            CHECK(best.inRangeDouble(doubles.data(), length, -5, 5) ==
+                  scalar.inRangeDouble(doubles.data(), length, -5, 5));
+        }
+        if (length == 0) {
+            continue;
+        }
+        THEN ("A single out of range value is detected, wherever it is") {
+            for (size_t index = 0; index < length; ++index) {
+                CAPTURE(index);
+                auto outOfRange = vector<int32_t>(length, 0);
+                outOfRange[index] = -1;
+                CHECK_FALSE(best.inRangeSigned(outOfRange.data(), length, 0, 0));
+
+                auto unsignedOutOfRange = vector<uint32_t>(length, 5);
+                unsignedOutOfRange[index] = 0x80000000u;
+                CHECK_FALSE(best.inRangeUnsigned(unsignedOutOfRange.data(), length, 0, 10));
+
+                auto nan = vector<double>(length, 0);
+                nan[index] = std::numeric_limits<double>::quiet_NaN();
+                CHECK_FALSE(best.inRangeDouble(nan.data(), length, -1, 1));
+                CHECK_FALSE(best.inRangeFloat(nan.data(), length, -1, 1));
+
+                auto huge = vector<double>(length, 0);
+                huge[index] = 1e300;
+                CHECK_FALSE(best.inRangeFloat(huge.data(), length, -FLT_MAX, FLT_MAX));
+            }
+        }
+    }
+}
+
+SCENARIO("Array kernel integer packing")
+{
+    const Implementation &scalar = scalarImplementation();
+    const Implementation &best = bestImplementation();
+    CAPTURE(best.name);
+
+    for (size_t size : {1, 2, 4}) {
+        for (auto length : lengths) {
+            CAPTURE(size);
+            CAPTURE(length);
+            auto values = integers(length);
+
+            vector<uint8_t> expected(length * size);
+            vector<uint8_t> packed(length * size);
+            scalar.pack(values.data(), length, size, expected.data());
+            best.pack(values.data(), length, size, packed.data());
+            CHECK(packed == expected);
+
+            vector<int32_t> signedExpected(length), signedValues(length);
+            scalar.unpackSigned(packed.data(), length, size, signedExpected.data());
+            best.unpackSigned(packed.data(), length, size, signedValues.data());
+            CHECK(signedValues == signedExpected);
+
+            vector<uint32_t> unsignedExpected(length), unsignedValues(length);
+            scalar.unpackUnsigned(packed.data(), length, size, unsignedExpected.data());
+            best.unpackUnsigned(packed.data(), length, size, unsignedValues.data());
+            CHECK(unsignedValues == unsignedExpected);
+
+            for (size_t index = 0; index < length; ++index) {
+                uint32_t mask = size == 4 ? UINT32_MAX : (1u << (8 * size)) - 1;
+                CHECK(unsignedValues[index] == (values[index] & mask));
+            }
+        }
+    }
+    GIVEN ("Negative values") {
+        const vector<int32_t> values = {-1, -128, 127, -32768};
+        vector<uint8_t> packed(values.size() * 2);
+        pack(values.data(), values.size(), 2, packed.data());
+
+        vector<int32_t> unpacked(values.size());
+        unpack(packed.data(), values.size(), 2, unpacked.data());
+        CHECK(unpacked == values);
+    }
+}
+
+SCENARIO("Array kernel fixed point conversions")
+{
+    const Implementation &scalar = scalarImplementation();
+    const Implementation &best = bestImplementation();
+    CAPTURE(best.name);
+
+    struct Test
+    {
+        QnmFormat format;
+        double amplitude;
+    };
+    const vector<Test> tests = {
+        {{1, 4, 0}, 7},  {{1, 2, 1}, 15},  {{2, 15, 0}, 0.99}, {{2, 8, 3}, 100},
+        {{4, 31, 0}, 1}, {{4, 16, 7}, 1e4}, {{4, 0, 0}, 1e9},
+    };
+    for (auto &test : tests) {
+        for (auto length : lengths) {
+            CAPTURE(test.format.size);
+            CAPTURE(test.format.fractional);
+            CAPTURE(test.format.shift);
+            CAPTURE(length);
+            auto values = reals(length, test.amplitude);
+
+            vector<uint8_t> expected(length * test.format.size);
+            vector<uint8_t> packed(length * test.format.size);
+            scalar.doubleToQnm(values.data(), length, test.format, expected.data());
+            best.doubleToQnm(values.data(), length, test.format, packed.data());
+            CHECK(packed == expected);
+
+            vector<double> doublesExpected(length), doubles(length);
+            scalar.qnmToDouble(packed.data(), length, test.format, doublesExpected.data());
+            best.qnmToDouble(packed.data(), length, test.format, doubles.data());
+            CHECK(doubles == doublesExpected);
+        }
+    }
+    GIVEN ("Values halfway between two steps") {
+        // Q3.4 in one byte: 1/16 steps, rounded half away from zero
+        const vector<double> values = {0.03125, -0.03125, 0.09375, -0.09375, 0.4999, 7.9375};
+        const QnmFormat format = {1, 4, 0};
+        const vector<double> expected = {0.0625, -0.0625, 0.125, -0.125, 0.5, 7.9375};
+
+        for (auto implementation : {&scalar, &best}) {
+            CAPTURE(implementation->name);
+            vector<uint8_t> packed(values.size());
+            implementation->doubleToQnm(values.data(), values.size(), format, packed.data());
+
+            vector<double> converted(values.size());
+            implementation->qnmToDouble(packed.data(), values.size(), format, converted.data());
+            CHECK(converted == expected);
+        }
+    }
+}
+
+SCENARIO("Array kernel float conversions")
+{
+    const Implementation &scalar = scalarImplementation();
+    const Implementation &best = bestImplementation();
+    CAPTURE(best.name);
+
+    for (auto length : lengths) {
+        CAPTURE(length);
+        auto values = reals(length, 1e10);
+
+        vector<uint8_t> expected(length * sizeof(float));
+        vector<uint8_t> packed(length * sizeof(float));
+        scalar.doubleToFloat(values.data(), length, expected.data());
+        best.doubleToFloat(values.data(), length, packed.data());
+        CHECK(packed == expected);
+
+        vector<double> doubles(length);
+        best.floatToDouble(packed.data(), length, doubles.data());
+        for (size_t index = 0; index < length; ++index) {
+            CHECK(doubles[index] == static_cast<float>(values[index]));
+        }
+    }
+}
+
+SCENARIO("Array kernel integer and linear conversions")
+{
+    const Implementation &scalar = scalarImplementation();
+    const Implementation &best = bestImplementation();
+    CAPTURE(best.name);
+
+    for (auto length : lengths) {
+        CAPTURE(length);
+        auto values = integers(length);
+        auto signedValues = vector<int32_t>(values.begin(), values.end());
+
+        vector<double> doubles(length), expected(length);
+        best.unsignedToDouble(values.data(), length, doubles.data());
+        scalar.unsignedToDouble(values.data(), length, expected.data());
+        CHECK(doubles == expected);
+
+        vector<uint32_t> unsignedBack(length);
+        best.doubleToUnsigned(doubles.data(), length, unsignedBack.data());
+        CHECK(unsignedBack == values);
+
+        best.signedToDouble(signedValues.data(), length, doubles.data());
+        scalar.signedToDouble(signedValues.data(), length, expected.data());
+        CHECK(doubles == expected);
+
+        vector<int32_t> signedBack(length);
+        best.doubleToSigned(doubles.data(), length, signedBack.data());
+        CHECK(signedBack == signedValues);
+
+        auto userValues = reals(length, 1000);
+        best.linearToInteger(userValues.data(), length, 10, 3, -7, doubles.data());
+        scalar.linearToInteger(userValues.data(), length, 10, 3, -7, expected.data());
+        CHECK(doubles == expected);
+
+        best.linearFromInteger(doubles.data(), length, -7, 3, 10, doubles.data());
+        scalar.linearFromInteger(expected.data(), length, -7, 3, 10, expected.data());
+        CHECK(doubles == expected);
+    }
+}
+
+} // namespace kernels
+} // namespace utility
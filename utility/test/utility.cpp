@@ -33,7 +33,9 @@
 
 #include <catch.hpp>
 #include <functional>
+#include <iomanip>
 #include <map>
+#include <sstream>
 
 using std::list;
 using std::string;
@@ -220,4 +222,41 @@ SCENARIO("binaryCopy bit exactness")
     }
 }
 
+SCENARIO("Formatting numbers as streams do")
+{
+    GIVEN ("Hexadecimal integers") {
+        for (uint64_t value :
+             {0ull, 1ull, 0xABull, 0x1234ull, 0xFFFFFFFFull, 0x8000000000000000ull}) {
+            for (size_t digits : {0, 2, 4, 8}) {
+                std::ostringstream stream;
+                stream << "0x" << std::hex << std::uppercase << std::setw(static_cast<int>(digits))
+                       << std::setfill('0') << value;
+                CHECK(toHexadecimal(value, digits) == stream.str());
+            }
+        }
+    }
+    GIVEN ("Floating point numbers") {
+        for (double value : {0., -0., 1., -1.5, 0.1, 1e-7, 123456789., 1e300, -2.5e-300}) {
+            std::ostringstream stream;
+            stream << value;
+            CHECK(formatFloatingPoint(value, 6) == stream.str());
+
+            for (int precision : {0, 3, 31}) {
+                std::ostringstream fixed;
+                fixed << std::fixed << std::setprecision(precision) << value;
+                CHECK(formatFloatingPoint(value, precision, true) == fixed.str());
+            }
+        }
+    }
+}
+
+SCENARIO("asJsonString")
+{
+    CHECK(asJsonString("") == "\"\"");
+    CHECK(asJsonString("/test/param") == "\"/test/param\"");
+    CHECK(asJsonString("a\"b\\c") == "\"a\\\"b\\\\c\"");
+    CHECK(asJsonString("a\nb\tc") == "\"a\\nb\\tc\"");
+    CHECK(asJsonString(std::string("\x01\x1f", 2)) == "\"\\u0001\\u001f\"");
+}
+
 } // namespace utility
@@ -29,6 +29,7 @@
  */
 #include "XmlStreamDocSink.h"
 #include <libxml/parser.h>
+#include <libxml/xmlsave.h>
 
 #define base CXmlDocSink
 
@@ -36,24 +37,39 @@ CXmlStreamDocSink::CXmlStreamDocSink(std::ostream &output) : _output(output)
 {
 }
 
+/** libxml2 output callback, writing to the std::ostream given as context */
+static int writeToStream(void *context, const char *buffer, int size)
+{
+    std::ostream &output = *static_cast<std::ostream *>(context);
+
+    output.write(buffer, size);
+
+    return output.good() ? size : -1;
+}
+
 bool CXmlStreamDocSink::doProcess(CXmlDocSource &xmlDocSource,
                                   CXmlSerializingContext &serializingContext)
 {
-    xmlChar *dumpedDoc = nullptr;
+    // Write the document as it is encoded, by blocks, rather than encoding it all in memory
+    xmlSaveCtxtPtr saveContext =
+        xmlSaveToIO(writeToStream, nullptr, &_output, "UTF-8", XML_SAVE_FORMAT);
 
-    int iSize;
-    xmlDocDumpFormatMemoryEnc(xmlDocSource.getDoc(), &dumpedDoc, &iSize, "UTF-8", 1);
+    if (saveContext == nullptr) {
 
-    if (!dumpedDoc) {
-
-        serializingContext.setError("Unable to encode XML document in memory");
+        serializingContext.setError("Unable to encode XML document");
 
         return false;
     }
 
-    _output << static_cast<unsigned char *>(dumpedDoc);
+    bool bSuccess = xmlSaveDoc(saveContext, xmlDocSource.getDoc()) != -1;
+
+    // Flushes the last block
+    bSuccess &= xmlSaveClose(saveContext) != -1;
 
-    xmlFree(dumpedDoc);
+    if (!bSuccess) {
+
+        serializingContext.setError("Unable to encode XML document");
+    }
 
-    return true;
+    return bSuccess;
 }
@@ -34,8 +34,8 @@
 #include "XmlSource.h"
 
 /**
-  * Sink class that writes the content of any CXmlDocSource into a std::string.
-  * A reference to an empty std::string is given in the constructor.
+  * Sink class that writes the content of any CXmlDocSource into a std::ostream.
+  * The document is written as it is encoded, not encoded in memory first.
   */
 class CXmlStreamDocSink : public CXmlDocSink
 {